@@ -1,15 +1,25 @@
 /**
  * @file ArrayADTList.h
- * @brief Array-based ADT list with Rule-of-Three and iterators.
+ * @brief Array-based ADT list with Rule-of-Five and iterators.
  */
 #ifndef ARRAY_ADT_LIST_H
 #define ARRAY_ADT_LIST_H
 
 #include <cstddef>
+#include <cstdint>
+#include <functional> // std::equal_to
+#include <iterator>   // std::random_access_iterator_tag
 #include <stdexcept>
-#include <algorithm> // std::copy
+#include <type_traits> // std::conditional_t, std::enable_if_t
+#include <algorithm> // std::copy, std::move
+#include <utility>   // std::move (single object)
+#include <vector>
 
-template <typename T>
+/**
+ * @tparam KeyEqual Stateless predicate that decides which item find(),
+ *         getItem() and deleteItem() match (default: operator==).
+ */
+template <typename T, typename KeyEqual = std::equal_to<T>>
 class ArrayADTList {
 private:
     T*          items_;
@@ -18,21 +28,58 @@ private:
 
 public:
     // ---------- Iterator -----------
-    class Iterator {
-        T* cur_;
-        T* end_;
+    // Random access, so the standard algorithms (std::sort, std::lower_bound,
+    // ...) work on the list directly. Only operator* checks the end.
+    // ConstIterator is what a const list hands out; Iterator converts to it.
+    template <bool Const>
+    class BasicIterator {
+        friend class ArrayADTList;
+        template <bool> friend class BasicIterator;
+        using Item = std::conditional_t<Const, const T, T>;
+        Item* cur_;
+        Item* end_;
     public:
-        Iterator(T* cur, T* end) : cur_(cur), end_(end) {}
-        T& operator*() const {
+        using iterator_category = std::random_access_iterator_tag;
+        using value_type        = T;
+        using difference_type   = std::ptrdiff_t;
+        using pointer           = Item*;
+        using reference         = Item&;
+
+        BasicIterator() : cur_(nullptr), end_(nullptr) {}
+        BasicIterator(Item* cur, Item* end) : cur_(cur), end_(end) {}
+        template <bool C = Const, typename = std::enable_if_t<C>>
+        BasicIterator(const BasicIterator<false>& it) : cur_(it.cur_), end_(it.end_) {}
+
+        Item& operator*() const {
             if (cur_ >= end_) throw std::out_of_range("Iterator at end");
             return *cur_;
         }
-        Iterator& operator++() { if (cur_ < end_) ++cur_; return *this; }
-        bool operator==(const Iterator& rhs) const { return cur_ == rhs.cur_; }
-        bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+        Item* operator->() const { return &**this; }
+        Item& operator[](difference_type n) const { return *(*this + n); }
+
+        BasicIterator& operator++() { if (cur_ < end_) ++cur_; return *this; }
+        BasicIterator  operator++(int) { BasicIterator old = *this; ++*this; return old; }
+        BasicIterator& operator--() { --cur_; return *this; }
+        BasicIterator  operator--(int) { BasicIterator old = *this; --cur_; return old; }
+        BasicIterator& operator+=(difference_type n) { cur_ += n; return *this; }
+        BasicIterator& operator-=(difference_type n) { cur_ -= n; return *this; }
+        BasicIterator  operator+(difference_type n) const { return BasicIterator(cur_ + n, end_); }
+        BasicIterator  operator-(difference_type n) const { return BasicIterator(cur_ - n, end_); }
+        friend BasicIterator operator+(difference_type n, const BasicIterator& it) { return it + n; }
+        difference_type operator-(const BasicIterator& rhs) const { return cur_ - rhs.cur_; }
+
+        bool operator==(const BasicIterator& rhs) const { return cur_ == rhs.cur_; }
+        bool operator!=(const BasicIterator& rhs) const { return !(*this == rhs); }
+        bool operator<(const BasicIterator& rhs)  const { return cur_ < rhs.cur_; }
+        bool operator>(const BasicIterator& rhs)  const { return cur_ > rhs.cur_; }
+        bool operator<=(const BasicIterator& rhs) const { return cur_ <= rhs.cur_; }
+        bool operator>=(const BasicIterator& rhs) const { return cur_ >= rhs.cur_; }
     };
 
-    // ---------- Ctors / dtor / assignment (Rule of 3) ----------
+    using Iterator      = BasicIterator<false>;
+    using ConstIterator = BasicIterator<true>;
+
+    // ---------- Ctors / dtor / assignment (Rule of 5) ----------
     ArrayADTList() : items_(new T[1000]), length_(0), capacity_(1000) {}
     explicit ArrayADTList(std::size_t cap)
         : items_(new T[cap]), length_(0), capacity_(cap) {}
@@ -56,6 +103,27 @@ public:
         return *this;
     }
 
+    // Moves hand over the array; the source is left empty with capacity 0
+    ArrayADTList(ArrayADTList&& other) noexcept
+        : items_(other.items_), length_(other.length_), capacity_(other.capacity_) {
+        other.items_ = nullptr;
+        other.length_ = 0;
+        other.capacity_ = 0;
+    }
+
+    ArrayADTList& operator=(ArrayADTList&& other) noexcept {
+        if (this != &other) {
+            delete[] items_;
+            items_   = other.items_;
+            length_  = other.length_;
+            capacity_= other.capacity_;
+            other.items_ = nullptr;
+            other.length_ = 0;
+            other.capacity_ = 0;
+        }
+        return *this;
+    }
+
     ~ArrayADTList() { delete[] items_; }
 
     // ---------- Basic ops ----------
@@ -70,32 +138,86 @@ public:
         items_[length_++] = item;
     }
 
+    void putItem(T&& item) {
+        if (isFull()) throw std::overflow_error("ArrayADTList is full");
+        items_[length_++] = std::move(item);
+    }
+
     // Remove first occurrence of key, keep order (shift-left)
     bool deleteItem(const T& key) {
+        Iterator pos = find(key);
+        if (pos == end()) return false;
+        erase(pos);
+        return true;
+    }
+
+    // Iterator to the first occurrence of key, or end() if absent
+    Iterator find(const T& key) {
         for (std::size_t i = 0; i < length_; ++i) {
-            if (items_[i] == key) {
-                for (std::size_t j = i + 1; j < length_; ++j)
-                    items_[j - 1] = items_[j];
-                --length_;
-                return true;
-            }
+            if (KeyEqual{}(items_[i], key)) return Iterator(items_ + i, items_ + length_);
         }
-        return false;
+        return end();
+    }
+
+    ConstIterator find(const T& key) const {
+        for (std::size_t i = 0; i < length_; ++i) {
+            if (KeyEqual{}(items_[i], key)) return ConstIterator(items_ + i, items_ + length_);
+        }
+        return end();
+    }
+
+    // Remove the item pos points at, keep order (shift-left);
+    // returns an iterator to the item that took its place
+    Iterator erase(Iterator pos) {
+        if (pos.cur_ < items_ || pos.cur_ >= items_ + length_) return end();
+        std::size_t i = static_cast<std::size_t>(pos.cur_ - items_);
+        std::move(items_ + i + 1, items_ + length_, items_ + i);
+        --length_;
+        return Iterator(items_ + i, items_ + length_);
     }
 
     // Lookup by key; if found, write value to found_item and return true
     bool getItem(const T& key, T& found_item) const {
         for (std::size_t i = 0; i < length_; ++i) {
-            if (items_[i] == key) { found_item = items_[i]; return true; }
+            if (KeyEqual{}(items_[i], key)) { found_item = items_[i]; return true; }
         }
         return false;
     }
 
+    /**
+     * @brief Reorders the items so position i holds the item that was at order[i].
+     *
+     * Follows the cycles of the permutation, so every item is moved once
+     * (plus one temporary per cycle) and no second array is allocated.
+     * @throws std::invalid_argument unless @p order is a permutation of 0..getLength()-1.
+     */
+    void permute(const std::vector<std::uint32_t>& order) {
+        if (order.size() != length_) throw std::invalid_argument("permute: order has the wrong length");
+        std::vector<bool> placed(length_, false);
+        for (std::uint32_t from : order) {
+            if (from >= length_ || placed[from]) throw std::invalid_argument("permute: order is not a permutation");
+            placed[from] = true;
+        }
+        std::fill(placed.begin(), placed.end(), false);
+        for (std::size_t start = 0; start < length_; ++start) {
+            if (placed[start] || order[start] == start) continue;
+            T held = std::move(items_[start]);
+            std::size_t to = start;
+            for (std::size_t from = order[to]; from != start; from = order[to]) {
+                items_[to] = std::move(items_[from]);
+                placed[to] = true;
+                to = from;
+            }
+            items_[to] = std::move(held);
+            placed[to] = true;
+        }
+    }
+
     // ---------- Iteration ----------
     Iterator begin() { return Iterator(items_, items_ + length_); }
     Iterator end()   { return Iterator(items_ + length_, items_ + length_); }
-    Iterator begin() const { return Iterator(items_, items_ + length_); }
-    Iterator end()   const { return Iterator(items_ + length_, items_ + length_); }
+    ConstIterator begin() const { return ConstIterator(items_, items_ + length_); }
+    ConstIterator end()   const { return ConstIterator(items_ + length_, items_ + length_); }
 };
 
 #endif // ARRAY_ADT_LIST_H
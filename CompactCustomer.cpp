@@ -0,0 +1,164 @@
+/**
+ * @file CompactCustomer.cpp
+ * @brief Implementation of CompactCustomer.
+ */
+#include "CompactCustomer.h"
+#include <stdexcept>
+
+// --- packing helpers ---
+// Matches `text` against `pattern` ('#' = digit, anything else literal) and
+// collects the digits into `value`.
+static bool packDigits(std::string_view text, std::string_view pattern, std::uint64_t& value) {
+    if (text.size() != pattern.size()) return false;
+    value = 0;
+    for (std::size_t i = 0; i < text.size(); ++i) {
+        if (pattern[i] == '#') {
+            if (text[i] < '0' || text[i] > '9') return false;
+            value = value * 10 + static_cast<std::uint64_t>(text[i] - '0');
+        } else if (text[i] != pattern[i]) {
+            return false;
+        }
+    }
+    return true;
+}
+
+static bool packID(std::string_view text, std::uint64_t& value) {
+    if (text.empty() || text.size() > 19) return false; // 19 digits always fit 64 bits
+    return packDigits(text, std::string(text.size(), '#'), value);
+}
+
+static bool packPostal(std::string_view text, std::uint64_t& value) {
+    return text.empty() || packDigits(text, "#####", value) || packDigits(text, "#########", value) ||
+           packDigits(text, "#####-####", value);
+}
+
+static bool packSSN(std::string_view text, std::uint64_t& value) {
+    return text.empty() || packDigits(text, "#########", value) || packDigits(text, "###-##-####", value);
+}
+
+// value printed with leading zeros to `width` digits
+static std::string zeroPad(std::uint64_t value, std::size_t width) {
+    std::string digits(width, '0');
+    for (std::size_t i = width; i-- > 0 && value; value /= 10) digits[i] = static_cast<char>('0' + value % 10);
+    return digits;
+}
+
+// ===== Constructors / conversion =====
+CompactCustomer::CompactCustomer() : pool(nullptr) {}
+
+CompactCustomer::CompactCustomer(const Customer& c, StringPool& p)
+    : pool(&p),
+      username(c.username), first_name(c.first_name), last_name(c.last_name),
+      street_address(c.street_address), email_address(c.email_address),
+      city(p.intern(c.city)), gender(p.intern(c.gender)),
+      company(p.intern(c.company)), job_title(p.intern(c.job_title)),
+      household_income(c.household_income), credit_score(c.credit_score), total_sales(c.total_sales),
+      customer_since(c.customer_since), date_of_birth(c.date_of_birth) {
+    std::uint64_t value = 0;
+    if (!packID(c.customer_id, value))
+        throw std::invalid_argument("CompactCustomer: customer_id is not 1-19 digits");
+    customer_id = value;
+    id_digits = static_cast<std::uint8_t>(c.customer_id.size());
+
+    if (c.state.size() > 2) throw std::invalid_argument("CompactCustomer: state is longer than 2 characters");
+    c.state.copy(state, c.state.size());
+
+    if (!packPostal(c.postal_code, value))
+        throw std::invalid_argument("CompactCustomer: postal_code is not #####, ######### or #####-####");
+    postal_code = static_cast<std::uint32_t>(value);
+    postal_digits = static_cast<std::uint8_t>(c.postal_code.size() == 5 ? 5 : c.postal_code.empty() ? 0 : 9);
+    postal_format = c.postal_code.empty() ? Empty : c.postal_code.size() == 10 ? Dashed : Digits;
+
+    if (!packSSN(c.social_security_number, value))
+        throw std::invalid_argument("CompactCustomer: social_security_number is not ######### or ###-##-####");
+    social_security_number = static_cast<std::uint32_t>(value);
+    ssn_format = c.social_security_number.empty() ? Empty
+               : c.social_security_number.size() == 11 ? Dashed : Digits;
+}
+
+bool CompactCustomer::fits(const Customer& c) {
+    std::uint64_t value = 0;
+    return packID(c.customer_id, value) && c.state.size() <= 2 &&
+           packPostal(c.postal_code, value) && packSSN(c.social_security_number, value);
+}
+
+Customer CompactCustomer::toCustomer() const {
+    return Customer(getCustomerID(), username, first_name, last_name, street_address,
+                    string(getCity()), string(getState()), getPostalCode(), email_address,
+                    string(getGender()), string(getCompany()), string(getJobTitle()),
+                    customer_since, getSocialSecurityNumber(), date_of_birth,
+                    household_income, credit_score, total_sales);
+}
+
+// Symbol 0 is the empty string in every pool, so a default record needs none
+std::string_view CompactCustomer::text(Symbol symbol) const {
+    return pool ? pool->view(symbol) : std::string_view();
+}
+
+// ===== Getters =====
+std::string CompactCustomer::getCustomerID() const { return zeroPad(customer_id, id_digits); }
+const std::string& CompactCustomer::getUserName() const { return username; }
+const std::string& CompactCustomer::getFirstName() const { return first_name; }
+const std::string& CompactCustomer::getLastName() const { return last_name; }
+const std::string& CompactCustomer::getStreetAddress() const { return street_address; }
+std::string_view CompactCustomer::getCity() const { return text(city); }
+std::string_view CompactCustomer::getState() const {
+    return std::string_view(state, state[1] ? 2 : state[0] ? 1 : 0);
+}
+
+std::string CompactCustomer::getPostalCode() const {
+    if (postal_format == Empty) return std::string();
+    std::string digits = zeroPad(postal_code, postal_digits);
+    if (postal_format == Dashed) digits.insert(5, 1, '-');
+    return digits;
+}
+
+const std::string& CompactCustomer::getEmail() const { return email_address; }
+std::string_view CompactCustomer::getGender() const { return text(gender); }
+std::string_view CompactCustomer::getCompany() const { return text(company); }
+std::string_view CompactCustomer::getJobTitle() const { return text(job_title); }
+Date CompactCustomer::getCustomerSince() const { return customer_since; }
+std::string CompactCustomer::getSocialSecurityNumber() const {
+    if (ssn_format == Empty) return std::string();
+    std::string digits = zeroPad(social_security_number, 9);
+    if (ssn_format == Dashed) {
+        digits.insert(5, 1, '-');
+        digits.insert(3, 1, '-');
+    }
+    return digits;
+}
+
+Date CompactCustomer::getDateOfBirth() const { return date_of_birth; }
+int CompactCustomer::getHouseholdIncome() const { return household_income; }
+int CompactCustomer::getCreditScore() const { return credit_score; }
+double CompactCustomer::getTotalSales() const { return total_sales; }
+
+// ===== Packed keys =====
+std::uint64_t CompactCustomer::getCustomerIDValue() const { return customer_id; }
+
+// Left-aligns an id to 19 digits ("45" -> 4500000000000000000), so comparing
+// aligned values compares the digit strings position by position. 10^19 - 1
+// still fits in 64 bits.
+static std::uint64_t alignID(std::uint64_t value, std::uint8_t digits) {
+    static const std::uint64_t POW10[20] = {
+        1ull, 10ull, 100ull, 1000ull, 10000ull, 100000ull, 1000000ull, 10000000ull, 100000000ull,
+        1000000000ull, 10000000000ull, 100000000000ull, 1000000000000ull, 10000000000000ull,
+        100000000000000ull, 1000000000000000ull, 10000000000000000ull, 100000000000000000ull,
+        1000000000000000000ull, 10000000000000000000ull};
+    return value * POW10[19 - digits];
+}
+
+int CompactCustomer::compareCustomerID(const CompactCustomer& rhs) const {
+    const std::uint64_t a = alignID(customer_id, id_digits);
+    const std::uint64_t b = alignID(rhs.customer_id, rhs.id_digits);
+    if (a != b) return a < b ? -1 : 1;
+    // equal once aligned: one id is a prefix of the other ("1" vs "10"), shorter first
+    if (id_digits != rhs.id_digits) return id_digits < rhs.id_digits ? -1 : 1;
+    return 0;
+}
+
+// ===== Symbols =====
+CompactCustomer::Symbol CompactCustomer::getCitySymbol() const { return city; }
+CompactCustomer::Symbol CompactCustomer::getGenderSymbol() const { return gender; }
+CompactCustomer::Symbol CompactCustomer::getCompanySymbol() const { return company; }
+CompactCustomer::Symbol CompactCustomer::getJobTitleSymbol() const { return job_title; }
@@ -0,0 +1,120 @@
+/**
+ * @file CompactCustomer.h
+ * @brief Memory-lean Customer record with interned low-cardinality fields.
+ */
+#ifndef COMPACT_CUSTOMER_H
+#define COMPACT_CUSTOMER_H
+
+#include <cstdint>
+#include <string>
+#include <string_view>
+#include "Customer.h"
+#include "Date.h"
+#include "StringPool.h"
+
+/**
+ * @brief A Customer whose repetitive fields live once in a shared StringPool
+ *        and whose fixed-format fields are packed into integers.
+ *
+ * city, gender, company and job_title repeat across millions of records, so
+ * they are stored as 32-bit symbols of a StringPool instead of one std::string
+ * each. Their getters return views into the pool (no allocation), and
+ * comparing two of them is an integer compare of the symbols.
+ *
+ * Fixed-format fields are packed inline:
+ * - customer_id: numeric, up to 19 digits, kept as a 64-bit value plus its
+ *   printed width, so leading zeros survive and ids compare (in string
+ *   order) as one integer;
+ * - state: at most 2 characters, kept in a char[2];
+ * - postal_code: "#####", "#########" or "#####-####", kept as a 32-bit value;
+ * - social_security_number: "#########" or "###-##-####", kept as a 32-bit value.
+ * The string getters for these rebuild the original text on request.
+ * Records that do not fit these formats are rejected (see fits()); keep those
+ * as plain Customer objects.
+ *
+ * The pool must outlive every record interned into it.
+ */
+class CompactCustomer {
+public:
+    using Symbol = StringPool::Symbol;
+
+    // ===== Constructors / conversion =====
+    CompactCustomer();
+    /// @throws std::invalid_argument if a packed field does not fit its format.
+    CompactCustomer(const Customer& customer, StringPool& pool);
+
+    /// @brief True if @p customer's packed fields all fit their formats.
+    static bool fits(const Customer& customer);
+
+    /// @brief Rebuilds a full Customer (allocates the interned strings).
+    Customer toCustomer() const;
+
+    // ===== Getters =====
+    string getCustomerID() const;
+    const string& getUserName() const;
+    const string& getFirstName() const;
+    const string& getLastName() const;
+    const string& getStreetAddress() const;
+    std::string_view getCity() const;
+    std::string_view getState() const;
+    string getPostalCode() const;
+    const string& getEmail() const;
+    std::string_view getGender() const;
+    std::string_view getCompany() const;
+    std::string_view getJobTitle() const;
+    Date getCustomerSince() const;
+    string getSocialSecurityNumber() const;
+    Date getDateOfBirth() const;
+    int getHouseholdIncome() const;
+    int getCreditScore() const;
+    double getTotalSales() const;
+
+    // ===== Packed keys =====
+    std::uint64_t getCustomerIDValue() const;
+
+    /**
+     * @brief Orders by customer id with integer compares (-1, 0 or 1).
+     *
+     * Same order as the id strings, i.e. as Customer's CustomerID mode:
+     * "10" < "9" and "07" < "7".
+     */
+    int compareCustomerID(const CompactCustomer& rhs) const;
+
+    // ===== Symbols (equal symbols <=> equal text within one pool) =====
+    Symbol getCitySymbol() const;
+    Symbol getGenderSymbol() const;
+    Symbol getCompanySymbol() const;
+    Symbol getJobTitleSymbol() const;
+
+private:
+    // How a packed postal code / SSN was written, so it prints back the same
+    enum PackedFormat : std::uint8_t { Empty, Digits, Dashed };
+
+    const StringPool* pool;  // resolves the symbols below
+    string username;
+    string first_name;
+    string last_name;
+    string street_address;
+    string email_address;
+    std::uint64_t customer_id   = 0;
+    Symbol        city          = 0;
+    Symbol        gender        = 0;
+    Symbol        company       = 0;
+    Symbol        job_title     = 0;
+    std::uint32_t postal_code   = 0;
+    std::uint32_t social_security_number = 0;
+    char          state[2]      = {0, 0};
+    std::uint8_t  id_digits     = 0;      // printed width of customer_id
+    std::uint8_t  postal_digits = 0;      // 0, 5 or 9
+    PackedFormat  postal_format = Empty;
+    PackedFormat  ssn_format    = Empty;
+    int    household_income = 0;
+    int    credit_score     = 0;
+    double total_sales      = 0.0;
+    Date   customer_since;
+    Date   date_of_birth;
+
+    std::string_view text(Symbol symbol) const;
+};
+
+#endif // COMPACT_CUSTOMER_H
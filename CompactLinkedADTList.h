@@ -0,0 +1,154 @@
+/**
+ * @file CompactLinkedADTList.h
+ * @brief Linked unordered list whose nodes live in one pool, linked by 32-bit indices.
+ *
+ * Same basic ADT operations as LinkedADTList (putItem/deleteItem/getItem/
+ * makeEmpty/iteration), but every node is an element of a single
+ * growable std::vector and links to its successor by a 32-bit index instead of
+ * a 64-bit pointer. That removes the per-node heap block (and its allocator
+ * header) and halves the link, so CompactLinkedADTList<int> spends 8 bytes per
+ * element instead of a 16-byte node in a 32-byte heap block. Copying the whole
+ * list is a single block copy of the pool.
+ *
+ * Freed slots are kept on a free list and reused by putItem. The list holds
+ * at most INT_MAX items, the most getLength() can report.
+ */
+#ifndef COMPACT_LINKED_ADT_LIST_H
+#define COMPACT_LINKED_ADT_LIST_H
+
+#include <climits>
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <utility>
+#include <vector>
+
+template <typename T>
+class CompactLinkedADTList {
+private:
+    static constexpr std::uint32_t NIL = 0xFFFFFFFFu;
+
+    struct Node {
+        T data;
+        std::uint32_t next;
+    };
+
+    std::vector<Node> pool_;
+    std::uint32_t head_;
+    std::uint32_t free_;  // first reusable slot, chained through next
+    int length_;
+
+public:
+    // ---------- Iterator -----------
+    class Iterator {
+        friend class CompactLinkedADTList;
+        std::vector<Node>* pool_;
+        std::uint32_t cur_;
+        Iterator(std::vector<Node>* pool, std::uint32_t cur) : pool_(pool), cur_(cur) {}
+    public:
+        T& operator*() const {
+            if (cur_ == NIL) throw std::out_of_range("Iterator at end");
+            return (*pool_)[cur_].data;
+        }
+        Iterator& operator++() { if (cur_ != NIL) cur_ = (*pool_)[cur_].next; return *this; }
+        bool operator==(const Iterator& rhs) const { return cur_ == rhs.cur_; }
+        bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+    };
+
+    // ---------- Ctors (copy/dtor are the pool's: one block copy) ----------
+    CompactLinkedADTList() : head_(NIL), free_(NIL), length_(0) {}
+    CompactLinkedADTList(const CompactLinkedADTList&) = default;
+    CompactLinkedADTList& operator=(const CompactLinkedADTList&) = default;
+
+    // Moves take the pool and leave @p other empty but usable
+    CompactLinkedADTList(CompactLinkedADTList&& other) noexcept
+        : pool_(std::move(other.pool_)), head_(other.head_), free_(other.free_), length_(other.length_) {
+        other.pool_.clear();
+        other.head_ = NIL;
+        other.free_ = NIL;
+        other.length_ = 0;
+    }
+
+    CompactLinkedADTList& operator=(CompactLinkedADTList&& other) noexcept {
+        if (this != &other) {
+            pool_ = std::move(other.pool_);
+            head_ = other.head_;
+            free_ = other.free_;
+            length_ = other.length_;
+            other.pool_.clear();
+            other.head_ = NIL;
+            other.free_ = NIL;
+            other.length_ = 0;
+        }
+        return *this;
+    }
+
+    /// @brief Pre-sizes the pool so the first @p count inserts do not reallocate.
+    void reserve(std::size_t count) { pool_.reserve(count); }
+
+    // ---------- Basic ops ----------
+    /**
+     * @brief Inserts @p item at the front of the list.
+     * @throws std::overflow_error once INT_MAX items are in the list.
+     */
+    void putItem(const T& item) {
+        if (isFull()) throw std::overflow_error("CompactLinkedADTList is full");
+        std::uint32_t slot;
+        if (free_ != NIL) {
+            slot = free_;
+            free_ = pool_[slot].next;
+            pool_[slot].data = item;
+        } else {
+            slot = static_cast<std::uint32_t>(pool_.size());
+            pool_.push_back(Node{item, NIL});
+        }
+        pool_[slot].next = head_;
+        head_ = slot;
+        ++length_;
+    }
+
+    // Remove first occurrence of key; its slot goes on the free list
+    bool deleteItem(const T& key) {
+        std::uint32_t* link = &head_;
+        for (std::uint32_t cur = head_; cur != NIL; cur = pool_[cur].next) {
+            if (pool_[cur].data == key) {
+                *link = pool_[cur].next;
+                pool_[cur].data = T();      // release what the payload owns
+                pool_[cur].next = free_;
+                free_ = cur;
+                --length_;
+                return true;
+            }
+            link = &pool_[cur].next;
+        }
+        return false;
+    }
+
+    // Lookup by key; if found, write value to found_item and return true
+    bool getItem(const T& key, T& found_item) const {
+        for (std::uint32_t cur = head_; cur != NIL; cur = pool_[cur].next) {
+            if (pool_[cur].data == key) { found_item = pool_[cur].data; return true; }
+        }
+        return false;
+    }
+
+    // Drops every node at once; the pool keeps its capacity
+    void makeEmpty() {
+        pool_.clear();
+        head_ = NIL;
+        free_ = NIL;
+        length_ = 0;
+    }
+
+    // Free slots are reused before the pool grows, so the pool never passes
+    // INT_MAX slots either, well below the NIL index
+    bool isFull() const { return length_ == INT_MAX; }
+
+    int getLength() const { return length_; }
+
+    // ---------- Iteration ----------
+    Iterator begin() { return Iterator(&pool_, head_); }
+    Iterator end()   { return Iterator(&pool_, NIL); }
+};
+
+#endif // COMPACT_LINKED_ADT_LIST_H
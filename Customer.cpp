@@ -1,34 +1,92 @@
 #include "Customer.h"
-#include <sstream>
+#include "CustomerComparators.h"
+#include <charconv>
+#include <cstring>
 #include <stdexcept>
-#include <vector>
-#include <cstdlib>
 #include <cctype>
 
 // Default compare option
 CustomerCompareOptions Customer::compareWith = FullName;
 
 // --- small helpers ---
-static inline std::string trim(const std::string& s) {
+static const std::size_t TSV_FIELDS = 18;
+
+static inline std::string_view trim(std::string_view s) {
     size_t i = 0, j = s.size();
     while (i < j && std::isspace(static_cast<unsigned char>(s[i]))) ++i;
     while (j > i && std::isspace(static_cast<unsigned char>(s[j-1]))) --j;
     return s.substr(i, j - i);
 }
 
-static std::vector<std::string> splitTSV(const std::string& line) {
-    std::vector<std::string> out;
-    std::string cur;
-    for (char c : line) {
-        if (c == '\t') { out.push_back(cur); cur.clear(); }
-        else { cur.push_back(c); }
+// Splits up to TSV_FIELDS tab-separated fields into views of `line`
+// (extra columns are ignored). Returns the number of fields found.
+static std::size_t splitTSV(std::string_view line, std::string_view (&fields)[TSV_FIELDS]) {
+    const char* cur = line.data();
+    const char* end = cur + line.size();
+    for (std::size_t n = 0; n < TSV_FIELDS; ++n) {
+        const void* tab = std::memchr(cur, '\t', static_cast<std::size_t>(end - cur));
+        if (!tab) {
+            fields[n] = std::string_view(cur, static_cast<std::size_t>(end - cur));
+            return n + 1;
+        }
+        const char* stop = static_cast<const char*>(tab);
+        fields[n] = std::string_view(cur, static_cast<std::size_t>(stop - cur));
+        cur = stop + 1;
+    }
+    return TSV_FIELDS;
+}
+
+// atoi/atof-style: leading sign allowed, trailing junk ignored, 0 on failure
+template <typename Number>
+static Number parseNumber(std::string_view s) {
+    if (!s.empty() && s.front() == '+') s.remove_prefix(1);
+    Number value = 0;
+    std::from_chars(s.data(), s.data() + s.size(), value);
+    return value;
+}
+
+static bool parseDigits(const char*& p, const char* end, int& value) {
+    const char* start = p;
+    value = 0;
+    while (p < end && *p >= '0' && *p <= '9' && p - start < 9) value = value * 10 + (*p++ - '0');
+    return p != start;
+}
+
+// "MM/DD/YYYY" without a stream; anything unusual goes through Date(string)
+static Date parseDate(std::string_view s) {
+    const char* p = s.data();
+    const char* end = p + s.size();
+    int m, d, y;
+    if (parseDigits(p, end, m) && p < end && *p++ == '/' &&
+        parseDigits(p, end, d) && p < end && *p++ == '/' &&
+        parseDigits(p, end, y) && p == end) {
+        return Date(y, m, d); // validates, throws std::out_of_range
     }
-    out.push_back(cur);
-    return out;
+    return Date(std::string(s));
+}
+
+// ===== Sort keys =====
+std::uint64_t Customer::prefixKey(std::string_view s) {
+    std::uint64_t key = 0;
+    const std::size_t n = s.size() < 8 ? s.size() : 8;
+    for (std::size_t i = 0; i < 8; ++i) {
+        key <<= 8;
+        if (i < n) key |= static_cast<unsigned char>(s[i]);
+    }
+    return key;
+}
+
+void Customer::refreshSortKeys() {
+    last_name_key   = prefixKey(last_name);
+    username_key    = prefixKey(username);
+    customer_id_key = prefixKey(customer_id);
+    customer_id_hash = std::hash<std::string>()(customer_id);
 }
 
 // ===== Constructors =====
-Customer::Customer() : customer_since("1/1/1970"), date_of_birth("1/1/1970") {}
+Customer::Customer() { // Date() is already 1/1/1970
+    customer_id_hash = std::hash<std::string>()(customer_id);
+}
 
 Customer::Customer(std::string id, std::string user, std::string first, std::string last,
                    std::string addr, std::string cty, std::string st, std::string postal,
@@ -39,89 +97,102 @@ Customer::Customer(std::string id, std::string user, std::string first, std::str
       street_address(std::move(addr)), city(std::move(cty)), state(std::move(st)), postal_code(std::move(postal)),
       email_address(std::move(email)), gender(std::move(gen)), company(std::move(comp)), job_title(std::move(job)),
       customer_since(since), social_security_number(std::move(ssn)), date_of_birth(dob),
-      household_income(income), credit_score(credit), total_sales(sales) {}
+      household_income(income), credit_score(credit), total_sales(sales) {
+    refreshSortKeys();
+}
+
+Customer::Customer(std::string_view record) {
+    parseTSV(record);
+}
 
-Customer::Customer(std::string record) : customer_since("1/1/1970"), date_of_birth("1/1/1970") {
-    // Expected field order (17 fields):
+void Customer::parseTSV(std::string_view record) {
+    // Expected field order (18 fields):
     // customer_id, username, first_name, last_name, street_address, city, state, postal_code,
     // email_address, gender, company, job_title, customer_since, social_security_number,
     // date_of_birth, household_income, credit_score, total_sales
-    // NOTE: The prompt lists 18+ fields with total_sales last. We'll accept either 18 (preferred) or 17
-    // and compute totals accordingly (robustness).
-    auto cols = splitTSV(record);
-    if (cols.size() < 18) {
-        // Some datasets list 18 fields exactly. If fewer, throw to catch bad lines early.
+    // Extra trailing columns are ignored.
+    std::string_view cols[TSV_FIELDS];
+    if (splitTSV(record, cols) < TSV_FIELDS) {
+        // Throw to catch bad lines early.
         throw std::runtime_error("Bad TSV record: wrong number of fields");
     }
 
-    customer_id             = trim(cols[0]);
-    username                = trim(cols[1]);
-    first_name              = trim(cols[2]);
-    last_name               = trim(cols[3]);
-    street_address          = trim(cols[4]);
-    city                    = trim(cols[5]);
-    state                   = trim(cols[6]);
-    postal_code             = trim(cols[7]);
-    email_address           = trim(cols[8]);
-    gender                  = trim(cols[9]);
-    company                 = trim(cols[10]);
-    job_title               = trim(cols[11]);
-
-    // Dates via your Date(string) ctor (expects "mm/dd/yyyy")
-    customer_since          = Date(trim(cols[12]));
-    social_security_number  = trim(cols[13]);
-    date_of_birth           = Date(trim(cols[14]));
+    // Parse the values that can fail before touching any member
+    Date since = parseDate(trim(cols[12]));
+    Date dob   = parseDate(trim(cols[14]));
+
+    customer_id            .assign(trim(cols[0]));
+    username               .assign(trim(cols[1]));
+    first_name             .assign(trim(cols[2]));
+    last_name              .assign(trim(cols[3]));
+    street_address         .assign(trim(cols[4]));
+    city                   .assign(trim(cols[5]));
+    state                  .assign(trim(cols[6]));
+    postal_code            .assign(trim(cols[7]));
+    email_address          .assign(trim(cols[8]));
+    gender                 .assign(trim(cols[9]));
+    company                .assign(trim(cols[10]));
+    job_title              .assign(trim(cols[11]));
+    customer_since          = since;
+    social_security_number .assign(trim(cols[13]));
+    date_of_birth           = dob;
+    refreshSortKeys();
 
     // Numbers
-    household_income        = std::atoi(trim(cols[15]).c_str());
-    credit_score            = std::atoi(trim(cols[16]).c_str());
-    total_sales             = std::atof(trim(cols[17]).c_str());
+    household_income        = parseNumber<int>(trim(cols[15]));
+    credit_score            = parseNumber<int>(trim(cols[16]));
+    total_sales             = parseNumber<double>(trim(cols[17]));
 }
 
 // ===== Getters/Setters =====
-void Customer::setCustomerID(std::string v) { customer_id = std::move(v); }
-std::string Customer::getCustomerID() { return customer_id; }
+void Customer::setCustomerID(std::string v) {
+    customer_id = std::move(v);
+    customer_id_key = prefixKey(customer_id);
+    customer_id_hash = std::hash<std::string>()(customer_id);
+}
+const std::string& Customer::getCustomerID() const { return customer_id; }
+std::size_t Customer::getCustomerIDHash() const { return customer_id_hash; }
 
-std::string Customer::getUserName() { return username; }
-void Customer::setUserName(std::string v) { username = std::move(v); }
+const std::string& Customer::getUserName() const { return username; }
+void Customer::setUserName(std::string v) { username = std::move(v); username_key = prefixKey(username); }
 
-std::string Customer::getFirstName() const { return first_name; }
+const std::string& Customer::getFirstName() const { return first_name; }
 void Customer::setFirstName(std::string v) { first_name = std::move(v); }
 
-std::string Customer::getLastName() const { return last_name; }
-void Customer::setLastName(std::string v) { last_name = std::move(v); }
+const std::string& Customer::getLastName() const { return last_name; }
+void Customer::setLastName(std::string v) { last_name = std::move(v); last_name_key = prefixKey(last_name); }
 
-std::string Customer::getStreetAddress() const { return street_address; }
+const std::string& Customer::getStreetAddress() const { return street_address; }
 void Customer::setStreetAddress(std::string v) { street_address = std::move(v); }
 
-std::string Customer::getCity() const { return city; }
+const std::string& Customer::getCity() const { return city; }
 void Customer::setCity(std::string v) { city = std::move(v); }
 
-std::string Customer::getState() const { return state; }
+const std::string& Customer::getState() const { return state; }
 void Customer::setState(std::string v) { state = std::move(v); }
 
-std::string Customer::getPostalCode() const { return postal_code; }
+const std::string& Customer::getPostalCode() const { return postal_code; }
 void Customer::setPostalCode(std::string v) { postal_code = std::move(v); }
 
-std::string Customer::getEmail() const { return email_address; }
+const std::string& Customer::getEmail() const { return email_address; }
 void Customer::setEmail(std::string v) { email_address = std::move(v); }
 
-std::string Customer::getGender() const { return gender; }
+const std::string& Customer::getGender() const { return gender; }
 void Customer::setGender(std::string v) { gender = std::move(v); }
 
-std::string Customer::getCompany() const { return company; }
+const std::string& Customer::getCompany() const { return company; }
 void Customer::setCompany(std::string v) { company = std::move(v); }
 
-std::string Customer::getJobTitle() const { return job_title; }
+const std::string& Customer::getJobTitle() const { return job_title; }
 void Customer::setJobTitle(std::string v) { job_title = std::move(v); }
 
 void Customer::setSocialSecurityNumber(std::string v) { social_security_number = std::move(v); }
-std::string Customer::getSocialSecurityNumber() { return social_security_number; }
+const std::string& Customer::getSocialSecurityNumber() const { return social_security_number; }
 
-Date Customer::getCustomerSince() const { return customer_since; }
+const Date& Customer::getCustomerSince() const { return customer_since; }
 void Customer::setCustomerSince(Date v) { customer_since = v; }
 
-Date Customer::getDateOfBirth() const { return date_of_birth; }
+const Date& Customer::getDateOfBirth() const { return date_of_birth; }
 void Customer::setDateOfBirth(Date v) { date_of_birth = v; }
 
 int Customer::getHouseholdIncome() const { return household_income; }
@@ -144,55 +215,47 @@ std::string Customer::toString() const {
 
 // ===== three-way compare =====
 int Customer::threeWayCompare(const Customer& rhs) const {
-    auto sgn = [](long long x) -> int { return (x < 0) ? -1 : (x > 0 ? 1 : 0); };
-
+    // The runtime mode picks one of the per-key comparators
     switch (compareWith) {
-        case FullName: {
-            // Sort by Last, then First (stable, readable)
-            std::string a = last_name + "\x1F" + first_name;   // \x1F just to avoid accidental collisions
-            std::string b = rhs.last_name + "\x1F" + rhs.first_name;
-            if (a < b) return -1; if (a > b) return 1; break;
-        }
-        case UserName:
-            if (username < rhs.username) return -1; if (username > rhs.username) return 1; break;
-        case CustomerID:
-            if (customer_id < rhs.customer_id) return -1; if (customer_id > rhs.customer_id) return 1; break;
-        case CustomerSince:
-            // Earlier date = "less" (has been a customer longer) — matches the example logic
-            if (customer_since < rhs.customer_since) return -1;
-            if (customer_since > rhs.customer_since) return 1;
-            break;
-        case DateOfBirth:
-            // Earlier DOB = "less" (older is less). Younger will be "greater".
-            if (date_of_birth < rhs.date_of_birth) return -1;
-            if (date_of_birth > rhs.date_of_birth) return 1;
-            break;
-        case CreditScore:
-            return sgn(static_cast<long long>(credit_score) - rhs.credit_score);
-        case HouseholdIncome:
-            return sgn(static_cast<long long>(household_income) - rhs.household_income);
-        case TotalSales: {
-            if (total_sales < rhs.total_sales) return -1;
-            if (total_sales > rhs.total_sales) return 1;
-            break;
-        }
+        case FullName:        return CustomerOrder<FullName>::compare(*this, rhs);
+        case UserName:        return CustomerOrder<UserName>::compare(*this, rhs);
+        case CustomerID:      return CustomerOrder<CustomerID>::compare(*this, rhs);
+        case CustomerSince:   return CustomerOrder<CustomerSince>::compare(*this, rhs);
+        case DateOfBirth:     return CustomerOrder<DateOfBirth>::compare(*this, rhs);
+        case CreditScore:     return CustomerOrder<CreditScore>::compare(*this, rhs);
+        case HouseholdIncome: return CustomerOrder<HouseholdIncome>::compare(*this, rhs);
+        case TotalSales:      return CustomerOrder<TotalSales>::compare(*this, rhs);
     }
-    // Tie-breaker for strict weak ordering
-    if (customer_id < rhs.customer_id) return -1;
-    if (customer_id > rhs.customer_id) return 1;
-    return 0;
+    return CustomerOrder<CustomerID>::compare(*this, rhs);
 }
 
 // ===== Relational operators =====
-bool Customer::operator==(const Customer& rhs) const { return threeWayCompare(rhs) == 0; }
-bool Customer::operator!=(const Customer& rhs) const { return threeWayCompare(rhs) != 0; }
+// Different id hashes mean different ids, so == can answer without the strings
+bool Customer::operator==(const Customer& rhs) const {
+    return customer_id_hash == rhs.customer_id_hash && threeWayCompare(rhs) == 0;
+}
+bool Customer::operator!=(const Customer& rhs) const { return !(*this == rhs); }
 bool Customer::operator<(const Customer& rhs)  const { return threeWayCompare(rhs) < 0; }
 bool Customer::operator<=(const Customer& rhs) const { return threeWayCompare(rhs) <= 0; }
 bool Customer::operator>(const Customer& rhs)  const { return threeWayCompare(rhs) > 0; }
 bool Customer::operator>=(const Customer& rhs) const { return threeWayCompare(rhs) >= 0; }
 
-// ===== stream operator =====
+// ===== stream operators =====
 std::ostream& operator<<(std::ostream& out, const Customer& customer) {
     return out << customer.toString();
 }
 
+std::istream& operator>>(std::istream& in, Customer& customer) {
+    thread_local std::string line;
+    while (std::getline(in, line)) {
+        if (trim(line).empty()) continue;
+        try {
+            customer.parseTSV(line);
+        } catch (const std::exception&) {
+            in.setstate(std::ios::failbit);
+        }
+        break;
+    }
+    return in;
+}
+
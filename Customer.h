@@ -1,7 +1,12 @@
 #ifndef CUSTOMER_H
 #define CUSTOMER_H
 
+#include <cstddef>
+#include <cstdint>
+#include <functional> // std::hash
 #include <string>
+#include <string_view>
+#include <istream>
 #include <ostream>
 #include "Date.h"
 
@@ -20,8 +25,29 @@ enum CustomerCompareOptions {
     TotalSales
 };
 
+// CustomerComparators.h
+template <CustomerCompareOptions Key> struct CustomerOrder;
+template <CustomerCompareOptions Key> struct CustomerEqual;
+template <CustomerCompareOptions Key> struct CustomerHash;
+
 class Customer {
 private:
+    // Compare/lookup keys sit in the first cache line of the record, the one a
+    // list prefetches, rather than after 400+ bytes of string members.
+    //
+    // Order-preserving 64-bit prefixes of the string sort keys: the first 8
+    // bytes, big-endian, zero-padded. Unequal prefixes order exactly like the
+    // strings; equal ones fall back to the full compare. Every write to
+    // last_name, username or customer_id refreshes its key.
+    std::uint64_t last_name_key   = 0;
+    std::uint64_t username_key    = 0;
+    std::uint64_t customer_id_key = 0;
+
+    // std::hash of customer_id, kept in step with it like the keys above.
+    // Every compare mode breaks ties on customer_id, so two customers are
+    // only ever equal when these match.
+    std::size_t customer_id_hash = 0;
+
     // Fields (match TSV order)
     string customer_id;
     string username;
@@ -42,12 +68,23 @@ private:
     int    credit_score     = 0;
     double total_sales      = 0.0;
 
+    static std::uint64_t prefixKey(std::string_view s);
+    void refreshSortKeys();
+
     // helper function to compare this customer with another one
     int threeWayCompare(const Customer& rhs) const;
 
     // shared comparison mode
     static CustomerCompareOptions compareWith;
 
+    // reads the fields directly when converting to the compact layout
+    friend class CompactCustomer;
+
+    // per-key comparators read the fields directly so they inline
+    template <CustomerCompareOptions Key> friend struct CustomerOrder;
+    template <CustomerCompareOptions Key> friend struct CustomerEqual;
+    template <CustomerCompareOptions Key> friend struct CustomerHash;
+
 public:
     // ===== Constructors =====
     Customer();
@@ -56,52 +93,66 @@ public:
              string email, string gender, string company, string job_title,
              Date customer_since, string social_security_number, Date date_of_birth,
              int household_income, int credit_score, double total_sales);
-    explicit Customer(string record); // TSV line
+    explicit Customer(std::string_view record); // TSV line
+
+    /**
+     * @brief Re-fills this customer from one TSV line, in place.
+     *
+     * Fields are split and trimmed as views into @p record; only the final
+     * member strings are written (reusing their existing capacity).
+     * @throws std::runtime_error if the line has fewer than 18 fields.
+     * @throws std::out_of_range if a date field is not a valid "MM/DD/YYYY".
+     */
+    void parseTSV(std::string_view record);
 
     // ===== Getters/Setters =====
+    // Getters return references to the record's own members, so reading a
+    // field never allocates. A reference stays valid until that field is
+    // set again or the Customer is destroyed.
     void setCustomerID(string customer_id);
-    string getCustomerID();
+    const string& getCustomerID() const;
+    std::size_t getCustomerIDHash() const; // cached std::hash of customer_id
 
-    string getUserName();
+    const string& getUserName() const;
     void setUserName(string username);
 
-    string getFirstName() const;
+    const string& getFirstName() const;
     void setFirstName(string first_name);
 
-    string getLastName() const;
+    const string& getLastName() const;
     void setLastName(string last_name);
 
-    string getStreetAddress() const;
+    const string& getStreetAddress() const;
     void setStreetAddress(string street_address);
 
-    string getCity() const;
+    const string& getCity() const;
     void setCity(string city);
 
-    string getState() const;
+    const string& getState() const;
     void setState(string state);
 
-    string getPostalCode() const;
+    const string& getPostalCode() const;
     void setPostalCode(string postal_code);
 
-    string getEmail() const;
+    const string& getEmail() const;
     void setEmail(string email);
 
-    string getGender() const;
+    const string& getGender() const;
     void setGender(string gender);
 
-    string getCompany() const;
+    const string& getCompany() const;
     void setCompany(string company);
 
-    string getJobTitle() const;
+    const string& getJobTitle() const;
     void setJobTitle(string job_title);
 
     void setSocialSecurityNumber(string social_security_number);
-    string getSocialSecurityNumber();
+    const string& getSocialSecurityNumber() const;
 
-    Date getCustomerSince() const;
+    const Date& getCustomerSince() const;
     void setCustomerSince(Date customer_since);
 
-    Date getDateOfBirth() const;
+    const Date& getDateOfBirth() const;
     void setDateOfBirth(Date date_of_birth);
 
     int getHouseholdIncome() const;
@@ -129,7 +180,29 @@ public:
     bool operator>=(const Customer& rhs) const;
 };
 
+/**
+ * @brief Hashes a Customer by its customer_id.
+ *
+ * Consistent with operator== in every compare mode, because equal customers
+ * always have equal ids. The hash is cached on the record, so this is a load.
+ */
+namespace std {
+template <>
+struct hash<Customer> {
+    size_t operator()(const Customer& c) const noexcept { return c.getCustomerIDHash(); }
+};
+} // namespace std
+
 // stream insertion (not a member)
 ostream& operator<<(ostream& out, const Customer& customer);
 
+/**
+ * @brief Reads the next non-blank TSV line into @p customer, in place.
+ *
+ * The line buffer is reused between calls (one per thread), so steady-state
+ * reads allocate only when a field outgrows the string it is copied into.
+ * A malformed line sets failbit and leaves @p customer unchanged.
+ */
+std::istream& operator>>(std::istream& in, Customer& customer);
+
 #endif // CUSTOMER_H
@@ -0,0 +1,135 @@
+/**
+ * @file CustomerAggregation.cpp
+ * @brief The hash aggregation behind CustomerAggregation (per-thread tables, merge, sort).
+ */
+#include "CustomerAggregation.h"
+#include <algorithm>
+#include <stdexcept>
+#include <thread>
+
+// ===== Query =====
+CustomerAggregation& CustomerAggregation::groupBy(CustomerField field) {
+    if (!isTextField(field))
+        throw std::invalid_argument("groupBy needs a text field");
+    groupBy_.push_back(field);
+    return *this;
+}
+
+CustomerAggregation& CustomerAggregation::measure(CustomerField field) {
+    if (!isNumericField(field)) throw std::invalid_argument("measure needs a numeric field");
+    measures_.push_back(field);
+    return *this;
+}
+
+// ===== Partial =====
+// FNV-1a: a handful of cycles for the short keys (state, gender, city) we group on
+static std::uint64_t hashKey(const std::string& key) {
+    std::uint64_t h = 14695981039346656037ull;
+    for (unsigned char ch : key) {
+        h ^= ch;
+        h *= 1099511628211ull;
+    }
+    return h;
+}
+
+CustomerAggregation::Partial::Partial(const CustomerAggregation& query)
+    : query_(&query), slots_(16, Slot{0, EMPTY}) {}
+
+void CustomerAggregation::Partial::grow() {
+    std::vector<Slot> old(slots_.size() * 2, Slot{0, EMPTY});
+    old.swap(slots_);
+    const std::size_t mask = slots_.size() - 1;
+    for (const Slot& slot : old) {
+        if (slot.group == EMPTY) continue;
+        std::size_t i = slot.hash & mask;
+        while (slots_[i].group != EMPTY) i = (i + 1) & mask;
+        slots_[i] = slot;
+    }
+}
+
+// Finds the group for compositeKey, creating it (from `customer`'s fields or
+// as a copy of `copyFrom`) on first sight
+CustomerGroup& CustomerAggregation::Partial::groupFor(const std::string& compositeKey, const Customer* customer,
+                                                      const CustomerGroup* copyFrom) {
+    const std::uint64_t h = hashKey(compositeKey);
+    const std::size_t mask = slots_.size() - 1;
+    std::size_t i = h & mask;
+    for (; slots_[i].group != EMPTY; i = (i + 1) & mask) {
+        if (slots_[i].hash == h && keys_[slots_[i].group] == compositeKey) return groups_[slots_[i].group];
+    }
+
+    // first row of a new group: the only place a row allocates
+    slots_[i] = Slot{h, static_cast<std::uint32_t>(groups_.size())};
+    keys_.push_back(compositeKey);
+    if (copyFrom) {
+        groups_.push_back(*copyFrom);
+    } else {
+        CustomerGroup group;
+        for (CustomerField f : query_->groupBy_) group.key.push_back(textField(*customer, f));
+        group.measures.resize(query_->measures_.size());
+        groups_.push_back(std::move(group));
+    }
+    CustomerGroup& created = groups_.back();
+    if (groups_.size() * 2 > slots_.size()) grow(); // keep the load factor <= 1/2
+    return created;
+}
+
+void CustomerAggregation::Partial::add(const Customer& customer) {
+    const std::vector<CustomerField>& fields = query_->groupBy_;
+    const std::string* key;
+    if (fields.size() == 1) {
+        key = &textField(customer, fields[0]); // look up by the field itself, no copy
+    } else {
+        keyBuffer_.clear();
+        for (std::size_t i = 0; i < fields.size(); ++i) {
+            if (i) keyBuffer_ += '\x1F';
+            keyBuffer_ += textField(customer, fields[i]);
+        }
+        key = &keyBuffer_;
+    }
+
+    CustomerGroup& group = groupFor(*key, &customer, nullptr);
+    ++group.count;
+    for (std::size_t m = 0; m < query_->measures_.size(); ++m) {
+        group.measures[m].add(numericField(customer, query_->measures_[m]));
+    }
+}
+
+void CustomerAggregation::Partial::merge(const Partial& other) {
+    for (std::size_t g = 0; g < other.groups_.size(); ++g) {
+        const CustomerGroup& theirs = other.groups_[g];
+        const std::size_t before = groups_.size();
+        CustomerGroup& mine = groupFor(other.keys_[g], nullptr, &theirs);
+        if (groups_.size() != before) continue; // new here: copied whole
+        mine.count += theirs.count;
+        for (std::size_t m = 0; m < mine.measures.size(); ++m) mine.measures[m].merge(theirs.measures[m]);
+    }
+}
+
+// ===== Running =====
+std::vector<CustomerGroup> CustomerAggregation::finish(Partial& partial) const {
+    std::vector<CustomerGroup> groups = std::move(partial.groups_);
+    std::sort(groups.begin(), groups.end(),
+              [](const CustomerGroup& a, const CustomerGroup& b) { return a.key < b.key; });
+    return groups;
+}
+
+std::vector<CustomerGroup> CustomerAggregation::runContiguous(const Customer* items, std::size_t n,
+                                                              unsigned threads) const {
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads > n / 16384 + 1) threads = static_cast<unsigned>(n / 16384 + 1); // >= 16K rows each
+
+    std::vector<Partial> partials(threads, Partial(*this));
+    auto scan = [&](unsigned t) {
+        const Customer* first = items + n * t / threads;
+        const Customer* last = items + n * (t + 1) / threads;
+        for (const Customer* c = first; c != last; ++c) partials[t].add(*c);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(scan, t);
+    scan(0);
+    for (std::thread& w : workers) w.join();
+
+    for (unsigned t = 1; t < threads; ++t) partials[0].merge(partials[t]);
+    return finish(partials[0]);
+}
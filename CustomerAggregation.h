@@ -0,0 +1,143 @@
+/**
+ * @file CustomerAggregation.h
+ * @brief Group-by with count/sum/min/max/avg over customer lists.
+ *
+ *     CustomerAggregation byState;
+ *     byState.groupBy(CustomerField::State)
+ *            .measure(CustomerField::TotalSales)
+ *            .measure(CustomerField::CreditScore);
+ *     for (const CustomerGroup& g : byState.runParallel(customers)) {
+ *         // g.key[0] = state, g.count, g.measures[0].sum, g.measures[1].average()
+ *     }
+ *
+ * Each worker thread aggregates its slice of the list into its own hash
+ * table (open addressing), so the scan shares nothing. The partial tables
+ * are merged at the end, one entry per group. Group lookups reuse a
+ * per-thread key buffer, so a row only allocates when it starts a new group.
+ */
+#ifndef CUSTOMER_AGGREGATION_H
+#define CUSTOMER_AGGREGATION_H
+
+#include <cstddef>
+#include <cstdint>
+#include <limits>
+#include <string>
+#include <vector>
+#include "ArrayADTList.h"
+#include "Customer.h"
+#include "CustomerField.h"
+
+/// @brief count/sum/min/max of one measure within one group.
+struct AggregateStats {
+    std::size_t count = 0;
+    double sum = 0.0;
+    double min = std::numeric_limits<double>::infinity();
+    double max = -std::numeric_limits<double>::infinity();
+
+    void add(double value) {
+        ++count;
+        sum += value;
+        if (value < min) min = value;
+        if (value > max) max = value;
+    }
+
+    void merge(const AggregateStats& other) {
+        count += other.count;
+        sum += other.sum;
+        if (other.min < min) min = other.min;
+        if (other.max > max) max = other.max;
+    }
+
+    /// @brief sum / count, or 0 for an empty group.
+    double average() const { return count ? sum / static_cast<double>(count) : 0.0; }
+};
+
+/// @brief One output row: the group's key values, row count and one AggregateStats per measure.
+struct CustomerGroup {
+    std::vector<std::string>    key;
+    std::size_t                 count = 0;
+    std::vector<AggregateStats> measures;
+};
+
+/**
+ * @brief A group-by query: the text fields to group on and the numeric fields to aggregate.
+ */
+class CustomerAggregation {
+public:
+    /**
+     * @brief Adds a grouping field; several fields group by their combination.
+     * @throws std::invalid_argument for numeric and date fields.
+     */
+    CustomerAggregation& groupBy(CustomerField field);
+
+    /**
+     * @brief Adds a measure: HouseholdIncome, CreditScore or TotalSales.
+     * @throws std::invalid_argument for other fields.
+     */
+    CustomerAggregation& measure(CustomerField field);
+
+    /**
+     * @brief One thread's hash table of groups.
+     *
+     * Cache-line aligned: runParallel keeps one per thread in a vector, and
+     * add() rewrites keyBuffer_ (inline in the object) on every row.
+     */
+    class alignas(64) Partial {
+    public:
+        explicit Partial(const CustomerAggregation& query);
+
+        void add(const Customer& customer);
+
+        /// @brief Folds @p other's groups into this table.
+        void merge(const Partial& other);
+
+    private:
+        friend class CustomerAggregation;
+
+        // Open-addressing index (linear probing, power-of-two size) from a
+        // composite key to its slot in groups_; cheaper per row than a
+        // node-based map when there are few groups and many rows.
+        struct Slot {
+            std::uint64_t hash;
+            std::uint32_t group; // EMPTY if unused
+        };
+        static constexpr std::uint32_t EMPTY = 0xFFFFFFFFu;
+
+        const CustomerAggregation* query_;
+        std::vector<Slot>          slots_;
+        std::vector<std::string>   keys_;      // composite key of each group
+        std::vector<CustomerGroup> groups_;
+        std::string                keyBuffer_;
+
+        CustomerGroup& groupFor(const std::string& compositeKey, const Customer* customer,
+                                const CustomerGroup* copyFrom);
+        void grow();
+    };
+
+    /// @brief Runs the query on one thread over any list; groups sorted by key.
+    template <typename List>
+    std::vector<CustomerGroup> run(List& list) const {
+        Partial partial(*this);
+        for (auto it = list.begin(); it != list.end(); ++it) partial.add(*it);
+        return finish(partial);
+    }
+
+    /**
+     * @brief Runs the query with @p threads threads; groups sorted by key.
+     * @param threads 0 = one per hardware thread.
+     */
+    template <typename KeyEqual>
+    std::vector<CustomerGroup> runParallel(ArrayADTList<Customer, KeyEqual>& list, unsigned threads = 0) const {
+        const std::size_t n = static_cast<std::size_t>(list.getLength());
+        return runContiguous(n ? &*list.begin() : nullptr, n, threads);
+    }
+
+private:
+    std::vector<CustomerField> groupBy_;
+    std::vector<CustomerField> measures_;
+
+    std::vector<CustomerGroup> runContiguous(const Customer* items, std::size_t n, unsigned threads) const;
+    std::vector<CustomerGroup> finish(Partial& partial) const;
+};
+
+#endif // CUSTOMER_AGGREGATION_H
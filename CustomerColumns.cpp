@@ -0,0 +1,179 @@
+/**
+ * @file CustomerColumns.cpp
+ * @brief Column snapshot and range-filter kernels.
+ */
+#include "CustomerColumns.h"
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#if defined(__SSE2__)
+#include <emmintrin.h>
+#define CUSTOMER_COLUMNS_SSE2 1
+#endif
+
+// --- kernels: each fills the 64-bit words of `out` for rows [0, n) ---
+namespace {
+
+// Bit counting on GCC/Clang builtins, plain C++ elsewhere
+#if defined(__GNUC__) || defined(__clang__)
+inline int popcount64(std::uint64_t x) { return __builtin_popcountll(x); }
+inline int lowestBit64(std::uint64_t x) { return __builtin_ctzll(x); } // x != 0
+#else
+inline int popcount64(std::uint64_t x) {
+    x = x - ((x >> 1) & 0x5555555555555555ull);
+    x = (x & 0x3333333333333333ull) + ((x >> 2) & 0x3333333333333333ull);
+    x = (x + (x >> 4)) & 0x0F0F0F0F0F0F0F0Full;
+    return static_cast<int>((x * 0x0101010101010101ull) >> 56);
+}
+inline int lowestBit64(std::uint64_t x) { return popcount64((x & (~x + 1)) - 1); } // x != 0
+#endif
+
+// Branch-free scalar filter of up to 64 rows into one word
+template <typename V>
+std::uint64_t scalarWord(const V* values, std::size_t n, V lo, V hi) {
+    std::uint64_t word = 0;
+    for (std::size_t i = 0; i < n; ++i) {
+        word |= static_cast<std::uint64_t>((lo <= values[i]) & (values[i] <= hi)) << i;
+    }
+    return word;
+}
+
+void filterInt(const std::int32_t* values, std::size_t n, std::int32_t lo, std::int32_t hi,
+               std::uint64_t* out) {
+    std::size_t full = n / 64;
+#ifdef CUSTOMER_COLUMNS_SSE2
+    const __m128i vlo = _mm_set1_epi32(lo);
+    const __m128i vhi = _mm_set1_epi32(hi);
+    for (std::size_t w = 0; w < full; ++w) {
+        const __m128i* block = reinterpret_cast<const __m128i*>(values + w * 64);
+        std::uint64_t word = 0;
+        for (int g = 0; g < 16; ++g) {     // 4 rows per compare
+            __m128i x = _mm_loadu_si128(block + g);
+            __m128i outside = _mm_or_si128(_mm_cmplt_epi32(x, vlo), _mm_cmpgt_epi32(x, vhi));
+            unsigned bits = ~static_cast<unsigned>(_mm_movemask_ps(_mm_castsi128_ps(outside))) & 0xFu;
+            word |= static_cast<std::uint64_t>(bits) << (4 * g);
+        }
+        out[w] = word;
+    }
+#else
+    for (std::size_t w = 0; w < full; ++w) out[w] = scalarWord(values + w * 64, 64, lo, hi);
+#endif
+    if (n % 64) out[full] = scalarWord(values + full * 64, n % 64, lo, hi);
+}
+
+void filterDouble(const double* values, std::size_t n, double lo, double hi, std::uint64_t* out) {
+    std::size_t full = n / 64;
+#ifdef CUSTOMER_COLUMNS_SSE2
+    const __m128d vlo = _mm_set1_pd(lo);
+    const __m128d vhi = _mm_set1_pd(hi);
+    for (std::size_t w = 0; w < full; ++w) {
+        const double* block = values + w * 64;
+        std::uint64_t word = 0;
+        for (int g = 0; g < 32; ++g) {     // 2 rows per compare; NaN compares false
+            __m128d x = _mm_loadu_pd(block + 2 * g);
+            __m128d inside = _mm_and_pd(_mm_cmpge_pd(x, vlo), _mm_cmple_pd(x, vhi));
+            word |= static_cast<std::uint64_t>(_mm_movemask_pd(inside)) << (2 * g);
+        }
+        out[w] = word;
+    }
+#else
+    for (std::size_t w = 0; w < full; ++w) out[w] = scalarWord(values + w * 64, 64, lo, hi);
+#endif
+    if (n % 64) out[full] = scalarWord(values + full * 64, n % 64, lo, hi);
+}
+
+// Narrows a double bound to the int32 range; lo rounds up, hi rounds down
+std::int32_t clampBound(double v) {
+    const double min = std::numeric_limits<std::int32_t>::min();
+    const double max = std::numeric_limits<std::int32_t>::max();
+    if (v <= min) return std::numeric_limits<std::int32_t>::min();
+    if (v >= max) return std::numeric_limits<std::int32_t>::max();
+    return static_cast<std::int32_t>(v);
+}
+
+} // namespace
+
+// ===== SelectionBitmap =====
+std::size_t SelectionBitmap::count() const {
+    std::size_t total = 0;
+    for (std::uint64_t word : words_) total += static_cast<std::size_t>(popcount64(word));
+    return total;
+}
+
+SelectionBitmap& SelectionBitmap::operator&=(const SelectionBitmap& other) {
+    if (other.rows_ != rows_) throw std::invalid_argument("SelectionBitmap sizes differ");
+    for (std::size_t i = 0; i < words_.size(); ++i) words_[i] &= other.words_[i];
+    return *this;
+}
+
+SelectionBitmap& SelectionBitmap::operator|=(const SelectionBitmap& other) {
+    if (other.rows_ != rows_) throw std::invalid_argument("SelectionBitmap sizes differ");
+    for (std::size_t i = 0; i < words_.size(); ++i) words_[i] |= other.words_[i];
+    return *this;
+}
+
+std::vector<std::uint32_t> SelectionBitmap::toSelection() const {
+    std::vector<std::uint32_t> rows;
+    rows.reserve(count());
+    for (std::size_t w = 0; w < words_.size(); ++w) {
+        for (std::uint64_t word = words_[w]; word; word &= word - 1) {  // clear lowest set bit
+            rows.push_back(static_cast<std::uint32_t>(w * 64 + lowestBit64(word)));
+        }
+    }
+    return rows;
+}
+
+// ===== CustomerColumns =====
+void CustomerColumns::reserve(std::size_t rows) {
+    credit_score_.reserve(rows);
+    household_income_.reserve(rows);
+    total_sales_.reserve(rows);
+    customer_since_.reserve(rows);
+    date_of_birth_.reserve(rows);
+}
+
+void CustomerColumns::append(const Customer& customer) {
+    credit_score_.push_back(customer.getCreditScore());
+    household_income_.push_back(customer.getHouseholdIncome());
+    total_sales_.push_back(customer.getTotalSales());
+    customer_since_.push_back(dateKey(customer.getCustomerSince()));
+    date_of_birth_.push_back(dateKey(customer.getDateOfBirth()));
+}
+
+void CustomerColumns::clear() {
+    credit_score_.clear();
+    household_income_.clear();
+    total_sales_.clear();
+    customer_since_.clear();
+    date_of_birth_.clear();
+}
+
+std::int32_t CustomerColumns::dateKey(const Date& date) {
+    return date.getYear() * 10000 + date.getMonth() * 100 + date.getDay();
+}
+
+SelectionBitmap CustomerColumns::selectRange(CustomerCompareOptions column, double lo, double hi) const {
+    SelectionBitmap result(size());
+    if (column == TotalSales) {
+        filterDouble(total_sales_.data(), size(), lo, hi, result.words_.data());
+        return result;
+    }
+
+    const std::vector<std::int32_t>* values = nullptr;
+    switch (column) {
+        case CreditScore:     values = &credit_score_;     break;
+        case HouseholdIncome: values = &household_income_; break;
+        case CustomerSince:   values = &customer_since_;   break;
+        case DateOfBirth:     values = &date_of_birth_;    break;
+        default:
+            throw std::invalid_argument("selectRange needs a numeric or date column");
+    }
+    lo = std::ceil(lo);
+    hi = std::floor(hi);
+    if (!(lo <= hi)) return result; // empty (or NaN) range selects nothing
+    if (lo > std::numeric_limits<std::int32_t>::max() || hi < std::numeric_limits<std::int32_t>::min())
+        return result;
+    filterInt(values->data(), size(), clampBound(lo), clampBound(hi), result.words_.data());
+    return result;
+}
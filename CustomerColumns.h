@@ -0,0 +1,126 @@
+/**
+ * @file CustomerColumns.h
+ * @brief Column-wise copy of the numeric Customer fields, with SIMD range filters.
+ *
+ * A filter such as "credit_score in [700, 800] and household_income > 100000"
+ * over a list of Customers touches one or two numbers per ~500-byte record.
+ * CustomerColumns copies those numbers into one contiguous array per field,
+ * so a filter streams through 4 bytes (8 for total_sales) per customer and
+ * compares several customers per instruction (SSE2 on x86-64, a branch-free
+ * scalar loop elsewhere):
+ *
+ *     CustomerColumns columns(customers);                 // snapshot, list order
+ *     SelectionBitmap hits = columns.selectRange(CreditScore, 700, 800);
+ *     hits &= columns.selectRange(HouseholdIncome, 100001, INT_MAX);
+ *     for (std::uint32_t row : hits.toSelection()) ...    // row = position in the list
+ *
+ * The columns are a snapshot: later changes to the list are not reflected.
+ * Dates are stored as yyyymmdd integers (see dateKey()), so date ranges are
+ * integer ranges as well.
+ */
+#ifndef CUSTOMER_COLUMNS_H
+#define CUSTOMER_COLUMNS_H
+
+#include <cstddef>
+#include <cstdint>
+#include <stdexcept>
+#include <vector>
+#include "Customer.h"
+#include "Date.h"
+
+/**
+ * @brief One bit per row; bit i set means row i passed the filter.
+ */
+class SelectionBitmap {
+public:
+    SelectionBitmap() = default;
+    explicit SelectionBitmap(std::size_t rows) : words_((rows + 63) / 64, 0), rows_(rows) {}
+
+    std::size_t size() const { return rows_; }
+
+    /// @brief Whether @p row is selected. @throws std::out_of_range unless row < size().
+    bool test(std::size_t row) const {
+        if (row >= rows_) throw std::out_of_range("SelectionBitmap row out of range");
+        return (words_[row / 64] >> (row % 64)) & 1u;
+    }
+
+    /// @brief Selects @p row. @throws std::out_of_range unless row < size().
+    void set(std::size_t row) {
+        if (row >= rows_) throw std::out_of_range("SelectionBitmap row out of range");
+        words_[row / 64] |= std::uint64_t(1) << (row % 64);
+    }
+
+    /// @brief Number of rows selected.
+    std::size_t count() const;
+
+    /// @brief Keeps only the rows also set in @p other (same size required).
+    SelectionBitmap& operator&=(const SelectionBitmap& other);
+
+    /// @brief Adds the rows set in @p other (same size required).
+    SelectionBitmap& operator|=(const SelectionBitmap& other);
+
+    /// @brief Ascending row numbers of the selected rows.
+    std::vector<std::uint32_t> toSelection() const;
+
+    const std::vector<std::uint64_t>& words() const { return words_; }
+
+private:
+    friend class CustomerColumns; // the range filters write whole words
+
+    std::vector<std::uint64_t> words_; // bits past size() are always 0
+    std::size_t rows_ = 0;
+};
+
+/**
+ * @brief Contiguous columns of credit_score, household_income, total_sales,
+ *        customer_since and date_of_birth.
+ */
+class CustomerColumns {
+public:
+    CustomerColumns() = default;
+
+    /// @brief Snapshots every customer of @p customers, in iteration order.
+    template <typename List>
+    explicit CustomerColumns(List& customers) {
+        reserve(static_cast<std::size_t>(customers.getLength()));
+        for (auto it = customers.begin(); it != customers.end(); ++it) append(*it);
+    }
+
+    void reserve(std::size_t rows);
+
+    /// @brief Adds one row holding @p customer's numeric fields.
+    void append(const Customer& customer);
+
+    void clear();
+
+    std::size_t size() const { return credit_score_.size(); }
+
+    /**
+     * @brief Selects the rows whose @p column lies in [@p lo, @p hi].
+     *
+     * @p column is one of CreditScore, HouseholdIncome, TotalSales,
+     * CustomerSince or DateOfBirth. Integer columns use the integers inside
+     * the range, so selectRange(CreditScore, 699.5, 800) means 700..800.
+     * NaN in total_sales never matches.
+     * @throws std::invalid_argument for the string keys (FullName, UserName, CustomerID).
+     */
+    SelectionBitmap selectRange(CustomerCompareOptions column, double lo, double hi) const;
+
+    /// @brief yyyymmdd, the value the date columns store and compare.
+    static std::int32_t dateKey(const Date& date);
+
+    const std::vector<std::int32_t>& creditScores()     const { return credit_score_; }
+    const std::vector<std::int32_t>& householdIncomes() const { return household_income_; }
+    const std::vector<double>&       totalSales()       const { return total_sales_; }
+    const std::vector<std::int32_t>& customerSince()    const { return customer_since_; }
+    const std::vector<std::int32_t>& datesOfBirth()     const { return date_of_birth_; }
+
+private:
+    std::vector<std::int32_t> credit_score_;
+    std::vector<std::int32_t> household_income_;
+    std::vector<double>       total_sales_;
+    std::vector<std::int32_t> customer_since_;
+    std::vector<std::int32_t> date_of_birth_;
+};
+
+#endif // CUSTOMER_COLUMNS_H
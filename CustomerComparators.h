@@ -0,0 +1,110 @@
+/**
+ * @file CustomerComparators.h
+ * @brief Stateless, per-key comparator types for Customer.
+ *
+ * Customer's own operators follow the global Customer::getCompareWith() mode
+ * and switch on it at run time. The types here fix the key at compile time
+ * instead, so two containers (or two threads) can order and search by
+ * different keys at once, and each compare inlines to the code for one key:
+ *
+ *     LinkedADTList<Customer, CustomerEqual<CustomerID>> byId;      // getItem by id
+ *     byId.sort(CustomerLess<CreditScore>());
+ *     std::sort(v.begin(), v.end(), CustomerLess<UserName>());
+ *
+ * The string keys (last_name, username, customer_id) are first compared on
+ * the 64-bit prefixes Customer caches for them, so most compares never touch
+ * the character data.
+ *
+ * Every key breaks ties on customer_id, exactly like threeWayCompare, so
+ * CustomerLess<K> is a strict weak ordering and CustomerEqual<K> agrees with
+ * operator== under compare mode K. They define a total order, not a lookup
+ * key: a probe that only carries a username never equals a stored customer.
+ * To find customers by a field other than customer_id, use
+ * IndexedCustomerList.
+ */
+#ifndef CUSTOMER_COMPARATORS_H
+#define CUSTOMER_COMPARATORS_H
+
+#include "Customer.h"
+
+/**
+ * @brief Three-way compare of two customers on @p Key.
+ *
+ * A friend of Customer, so it reads the fields directly.
+ */
+template <CustomerCompareOptions Key>
+struct CustomerOrder {
+    /// @brief Negative, zero or positive as @p a orders before, with or after @p b.
+    static int compare(const Customer& a, const Customer& b) {
+        if (int c = compareKey(a, b)) return c;
+        return compareString(a.customer_id_key, a.customer_id, b.customer_id_key, b.customer_id); // tie-breaker
+    }
+
+private:
+    template <typename U>
+    static int order(const U& x, const U& y) { return (y < x) - (x < y); }
+
+    static int sign(int x) { return (x > 0) - (x < 0); }
+
+    // Resolves on the cached prefixes; reads the strings only on a tie
+    static int compareString(std::uint64_t xKey, const std::string& x, std::uint64_t yKey, const std::string& y) {
+        if (xKey != yKey) return xKey < yKey ? -1 : 1;
+        return sign(x.compare(y));
+    }
+
+    static int compareKey(const Customer& a, const Customer& b) {
+        if constexpr (Key == FullName) {
+            if (int c = compareString(a.last_name_key, a.last_name, b.last_name_key, b.last_name)) return c;
+            return sign(a.first_name.compare(b.first_name));
+        } else if constexpr (Key == UserName) {
+            return compareString(a.username_key, a.username, b.username_key, b.username);
+        } else if constexpr (Key == CustomerID) {
+            return 0; // the tie-breaker is the key
+        } else if constexpr (Key == CustomerSince) {
+            return order(a.customer_since, b.customer_since); // earlier = customer longer = less
+        } else if constexpr (Key == DateOfBirth) {
+            return order(a.date_of_birth, b.date_of_birth);   // earlier = older = less
+        } else if constexpr (Key == CreditScore) {
+            return order(a.credit_score, b.credit_score);
+        } else if constexpr (Key == HouseholdIncome) {
+            return order(a.household_income, b.household_income);
+        } else {
+            static_assert(Key == TotalSales, "unhandled CustomerCompareOptions value");
+            return order(a.total_sales, b.total_sales);
+        }
+    }
+};
+
+/// @brief Strict weak ordering on @p Key; use with sort().
+template <CustomerCompareOptions Key>
+struct CustomerLess {
+    bool operator()(const Customer& a, const Customer& b) const {
+        return CustomerOrder<Key>::compare(a, b) < 0;
+    }
+};
+
+/**
+ * @brief Equality on @p Key; the KeyEqual parameter of the list templates.
+ *
+ * Rejects on the cached customer_id hashes first: one integer compare
+ * settles almost every mismatch.
+ */
+template <CustomerCompareOptions Key>
+struct CustomerEqual {
+    bool operator()(const Customer& a, const Customer& b) const {
+        return a.customer_id_hash == b.customer_id_hash && CustomerOrder<Key>::compare(a, b) == 0;
+    }
+};
+
+/**
+ * @brief Hash matching CustomerEqual<Key>, for unordered containers.
+ *
+ * Equality on any key includes the customer_id tie-break, so the cached id
+ * hash is consistent with every key and is used for all of them.
+ */
+template <CustomerCompareOptions Key>
+struct CustomerHash {
+    std::size_t operator()(const Customer& c) const noexcept { return c.customer_id_hash; }
+};
+
+#endif // CUSTOMER_COMPARATORS_H
@@ -0,0 +1,46 @@
+/**
+ * @file CustomerField.cpp
+ * @brief Field-by-name accessors for Customer.
+ */
+#include "CustomerField.h"
+#include <stdexcept>
+
+// ===== Field access =====
+bool isNumericField(CustomerField field) {
+    return field == CustomerField::HouseholdIncome || field == CustomerField::CreditScore ||
+           field == CustomerField::TotalSales;
+}
+
+bool isTextField(CustomerField field) {
+    return !isNumericField(field) && field != CustomerField::CustomerSince && field != CustomerField::DateOfBirth;
+}
+
+double numericField(const Customer& customer, CustomerField field) {
+    switch (field) {
+        case CustomerField::HouseholdIncome: return customer.getHouseholdIncome();
+        case CustomerField::CreditScore:     return customer.getCreditScore();
+        case CustomerField::TotalSales:      return customer.getTotalSales();
+        default:
+            throw std::invalid_argument("Not a numeric customer field");
+    }
+}
+
+const std::string& textField(const Customer& customer, CustomerField field) {
+    switch (field) {
+        case CustomerField::CustomerID:           return customer.getCustomerID();
+        case CustomerField::UserName:             return customer.getUserName();
+        case CustomerField::FirstName:            return customer.getFirstName();
+        case CustomerField::LastName:             return customer.getLastName();
+        case CustomerField::StreetAddress:        return customer.getStreetAddress();
+        case CustomerField::City:                 return customer.getCity();
+        case CustomerField::State:                return customer.getState();
+        case CustomerField::PostalCode:           return customer.getPostalCode();
+        case CustomerField::Email:                return customer.getEmail();
+        case CustomerField::Gender:               return customer.getGender();
+        case CustomerField::Company:              return customer.getCompany();
+        case CustomerField::JobTitle:             return customer.getJobTitle();
+        case CustomerField::SocialSecurityNumber: return customer.getSocialSecurityNumber();
+        default:
+            throw std::invalid_argument("Not a text customer field");
+    }
+}
@@ -0,0 +1,36 @@
+/**
+ * @file CustomerField.h
+ * @brief Names for Customer fields and by-name access to their values.
+ */
+#ifndef CUSTOMER_FIELD_H
+#define CUSTOMER_FIELD_H
+
+#include <string>
+#include "Customer.h"
+
+/// @brief Names one Customer field, in TSV order.
+enum class CustomerField {
+    CustomerID, UserName, FirstName, LastName, StreetAddress, City, State, PostalCode,
+    Email, Gender, Company, JobTitle, CustomerSince, SocialSecurityNumber, DateOfBirth,
+    HouseholdIncome, CreditScore, TotalSales
+};
+
+/// @brief True for HouseholdIncome, CreditScore and TotalSales.
+bool isNumericField(CustomerField field);
+
+/// @brief True for the text fields: all but the numbers and the two dates.
+bool isTextField(CustomerField field);
+
+/**
+ * @brief The value of a numeric field.
+ * @throws std::invalid_argument if @p field is not numeric.
+ */
+double numericField(const Customer& customer, CustomerField field);
+
+/**
+ * @brief The value of a text field (no copy).
+ * @throws std::invalid_argument for numeric and date fields.
+ */
+const std::string& textField(const Customer& customer, CustomerField field);
+
+#endif // CUSTOMER_FIELD_H
@@ -0,0 +1,248 @@
+/**
+ * @file CustomerLoader.cpp
+ * @brief Implementation of the bulk Customer loaders.
+ */
+#include "CustomerLoader.h"
+#include <chrono>
+#include <cstring>
+#include <exception>
+#include <fstream>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+#if defined(__unix__) || defined(__APPLE__)
+#define CUSTOMER_LOADER_HAS_MMAP 1
+#include <fcntl.h>
+#include <sys/mman.h>
+#include <sys/stat.h>
+#include <unistd.h>
+#endif
+
+namespace {
+
+// Result of parsing one byte range
+struct ChunkResult {
+    std::vector<Customer> customers;
+    std::size_t malformed = 0;
+    std::exception_ptr error;
+};
+
+bool isBlank(const char* p, const char* end) {
+    for (; p < end; ++p) {
+        if (*p != ' ' && *p != '\t' && *p != '\r' && *p != '\n' && *p != '\f' && *p != '\v') return false;
+    }
+    return true;
+}
+
+// Calls visit(line) for every non-blank line in [data, data + size)
+template <typename Visitor>
+void forEachLine(const char* data, std::size_t size, Visitor visit) {
+    const char* cur = data;
+    const char* end = data + size;
+    while (cur < end) {
+        const void* nl = std::memchr(cur, '\n', static_cast<std::size_t>(end - cur));
+        const char* stop = nl ? static_cast<const char*>(nl) : end;
+        if (!isBlank(cur, stop)) visit(std::string_view(cur, static_cast<std::size_t>(stop - cur)));
+        cur = stop + 1;
+    }
+}
+
+// Parses every line in [data, data + size) and appends the customers to out
+void parseLines(const char* data, std::size_t size, ChunkResult& out) {
+    forEachLine(data, size, [&out](std::string_view line) {
+        // parse straight into the result slot, no intermediate copy
+        out.customers.emplace_back();
+        try {
+            out.customers.back().parseTSV(line);
+        } catch (const std::exception&) {
+            out.customers.pop_back();
+            ++out.malformed;
+        }
+    });
+}
+
+// Upper bound on the records in a buffer: its line count
+std::size_t countLines(const char* data, std::size_t size) {
+    std::size_t lines = 0;
+    const char* cur = data;
+    const char* end = data + size;
+    while (cur < end) {
+        const void* nl = std::memchr(cur, '\n', static_cast<std::size_t>(end - cur));
+        ++lines;
+        if (!nl) break;
+        cur = static_cast<const char*>(nl) + 1;
+    }
+    return lines;
+}
+
+// Read-only view of a whole file: a mapping where available, else a buffer
+class FileBytes {
+public:
+    explicit FileBytes(const std::string& path) {
+#ifdef CUSTOMER_LOADER_HAS_MMAP
+        int fd = ::open(path.c_str(), O_RDONLY);
+        if (fd < 0) throw std::runtime_error("Cannot open " + path);
+        struct stat st;
+        if (::fstat(fd, &st) != 0) {
+            ::close(fd);
+            throw std::runtime_error("Cannot stat " + path);
+        }
+        size_ = static_cast<std::size_t>(st.st_size);
+        if (size_ > 0) {
+            void* map = ::mmap(nullptr, size_, PROT_READ, MAP_PRIVATE, fd, 0);
+            if (map == MAP_FAILED) {
+                ::close(fd);
+                throw std::runtime_error("Cannot map " + path);
+            }
+            ::madvise(map, size_, MADV_SEQUENTIAL);
+            map_ = map;
+            data_ = static_cast<const char*>(map);
+        }
+        ::close(fd); // the mapping stays valid
+#else
+        std::ifstream in(path, std::ios::binary | std::ios::ate);
+        if (!in) throw std::runtime_error("Cannot open " + path);
+        buffer_.resize(static_cast<std::size_t>(in.tellg()));
+        in.seekg(0);
+        in.read(&buffer_[0], static_cast<std::streamsize>(buffer_.size()));
+        data_ = buffer_.data();
+        size_ = buffer_.size();
+#endif
+    }
+
+    ~FileBytes() {
+#ifdef CUSTOMER_LOADER_HAS_MMAP
+        if (map_) ::munmap(map_, size_);
+#endif
+    }
+
+    FileBytes(const FileBytes&) = delete;
+    FileBytes& operator=(const FileBytes&) = delete;
+
+    const char* data() const { return data_; }
+    std::size_t size() const { return size_; }
+
+private:
+    const char* data_ = "";
+    std::size_t size_ = 0;
+#ifdef CUSTOMER_LOADER_HAS_MMAP
+    void* map_ = nullptr;
+#else
+    std::string buffer_;
+#endif
+};
+
+// Reads the lines whose first byte lies in [begin, end) and parses them.
+// A line belongs to the range holding its first byte, so a worker skips the
+// partial line it starts in and finishes the line that crosses its end.
+void loadRange(const std::string& path, std::size_t begin, std::size_t end, ChunkResult& out) {
+    try {
+        std::ifstream in(path, std::ios::binary);
+        if (!in) throw std::runtime_error("Cannot open " + path);
+
+        std::size_t start = begin;
+        if (begin > 0) {
+            in.seekg(static_cast<std::streamoff>(begin - 1));
+            char prev = '\n';
+            in.get(prev);
+            if (prev != '\n') {
+                std::string partial;
+                std::getline(in, partial);
+                if (!in || in.eof()) return; // the partial line ran to end of file
+                start = static_cast<std::size_t>(in.tellg());
+            }
+        }
+        if (start >= end) return;
+
+        std::string buffer(end - start, '\0');
+        in.seekg(static_cast<std::streamoff>(start));
+        in.read(&buffer[0], static_cast<std::streamsize>(buffer.size()));
+        buffer.resize(static_cast<std::size_t>(in.gcount()));
+        if (!buffer.empty() && buffer.back() != '\n' && in) {
+            std::string rest;
+            std::getline(in, rest);
+            buffer += rest;
+        }
+        parseLines(buffer.data(), buffer.size(), out);
+    } catch (...) {
+        out.error = std::current_exception();
+    }
+}
+
+} // namespace
+
+ArrayADTList<Customer> loadCustomersParallel(const std::string& path,
+                                             const CustomerLoadOptions& options,
+                                             CustomerLoadStats* stats) {
+    auto started = std::chrono::steady_clock::now();
+
+    std::ifstream probe(path, std::ios::binary | std::ios::ate);
+    if (!probe) throw std::runtime_error("Cannot open " + path);
+    const std::size_t size = static_cast<std::size_t>(probe.tellg());
+    probe.close();
+
+    unsigned threads = options.threads ? options.threads : std::thread::hardware_concurrency();
+    if (threads == 0) threads = 1;
+    const std::size_t minChunk = options.minChunkBytes ? options.minChunkBytes : 1;
+    std::size_t chunks = size / minChunk;
+    if (chunks > threads) chunks = threads;
+    if (chunks == 0) chunks = 1;
+
+    // One worker per range; the calling thread takes the first one
+    std::vector<ChunkResult> results(chunks);
+    std::vector<std::thread> workers;
+    for (std::size_t i = 1; i < chunks; ++i) {
+        workers.emplace_back(loadRange, std::cref(path), size * i / chunks, size * (i + 1) / chunks,
+                             std::ref(results[i]));
+    }
+    loadRange(path, 0, size / chunks, results[0]);
+    for (std::thread& t : workers) t.join();
+
+    std::size_t total = 0;
+    std::size_t malformed = 0;
+    for (const ChunkResult& r : results) {
+        if (r.error) std::rethrow_exception(r.error);
+        total += r.customers.size();
+        malformed += r.malformed;
+    }
+
+    // Join the ranges in file order
+    ArrayADTList<Customer> list(total);
+    for (ChunkResult& r : results) {
+        for (Customer& c : r.customers) list.putItem(std::move(c));
+    }
+
+    if (stats) {
+        stats->records = total;
+        stats->malformedLines = malformed;
+        stats->bytes = size;
+        stats->chunks = static_cast<unsigned>(chunks);
+        stats->seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    }
+    return list;
+}
+
+CustomerLoadResult loadCustomersMapped(const std::string& path) {
+    auto started = std::chrono::steady_clock::now();
+    FileBytes file(path);
+
+    CustomerLoadResult result{ArrayADTList<Customer>(countLines(file.data(), file.size())),
+                              CustomerLoadStats()};
+    Customer customer;
+    forEachLine(file.data(), file.size(), [&](std::string_view line) {
+        try {
+            customer.parseTSV(line);
+        } catch (const std::exception&) {
+            ++result.stats.malformedLines;
+            return;
+        }
+        result.customers.putItem(std::move(customer));
+    });
+
+    result.stats.records = static_cast<std::size_t>(result.customers.getLength());
+    result.stats.bytes = file.size();
+    result.stats.chunks = 1;
+    result.stats.seconds = std::chrono::duration<double>(std::chrono::steady_clock::now() - started).count();
+    return result;
+}
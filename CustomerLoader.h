@@ -0,0 +1,72 @@
+/**
+ * @file CustomerLoader.h
+ * @brief Bulk loading of Customer TSV files into an ArrayADTList.
+ */
+#ifndef CUSTOMER_LOADER_H
+#define CUSTOMER_LOADER_H
+
+#include <cstddef>
+#include <string>
+#include "ArrayADTList.h"
+#include "Customer.h"
+
+/**
+ * @brief Tuning knobs for loadCustomersParallel().
+ */
+struct CustomerLoadOptions {
+    unsigned    threads       = 0;        ///< worker threads, 0 = one per hardware thread
+    std::size_t minChunkBytes = 1 << 20;  ///< never split the file finer than this
+};
+
+/**
+ * @brief What a bulk load did.
+ */
+struct CustomerLoadStats {
+    std::size_t records        = 0;   ///< customers loaded
+    std::size_t malformedLines = 0;   ///< non-blank lines that did not parse (skipped)
+    std::size_t bytes          = 0;   ///< size of the input file
+    unsigned    chunks         = 0;   ///< byte ranges parsed independently
+    double      seconds        = 0.0; ///< wall-clock time of the whole load
+};
+
+/**
+ * @brief Loads every customer of a TSV file using a pool of worker threads.
+ *
+ * The file is cut into newline-aligned byte ranges; each worker reads and
+ * parses its own range into a private buffer of Customers, and the results are
+ * moved into one list sized to fit exactly. Records keep their file order
+ * (chunk results are joined in range order, which costs nothing extra).
+ * Blank lines are skipped, malformed lines are skipped and counted.
+ *
+ * @param path    TSV file to read.
+ * @param options Thread count and minimum chunk size.
+ * @param stats   If not null, receives counts and timing.
+ * @throws std::runtime_error if the file cannot be opened or read.
+ */
+ArrayADTList<Customer> loadCustomersParallel(const std::string& path,
+                                             const CustomerLoadOptions& options = CustomerLoadOptions(),
+                                             CustomerLoadStats* stats = nullptr);
+
+/**
+ * @brief A loaded list together with the statistics of the load.
+ */
+struct CustomerLoadResult {
+    ArrayADTList<Customer> customers;
+    CustomerLoadStats      stats;
+};
+
+/**
+ * @brief Loads a TSV file by parsing straight out of a memory mapping.
+ *
+ * The file is mmap'ed read-only with MADV_SEQUENTIAL, lines are counted to size
+ * the list once, and each record is split in place in the mapped bytes; a
+ * Customer is only written after its field boundaries are known. There is no
+ * stream and no intermediate line buffer. Platforms without mmap read the file
+ * into one buffer instead. Blank lines are skipped, malformed lines are
+ * skipped and counted.
+ *
+ * @throws std::runtime_error if the file cannot be opened or mapped.
+ */
+CustomerLoadResult loadCustomersMapped(const std::string& path);
+
+#endif // CUSTOMER_LOADER_H
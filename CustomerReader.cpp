@@ -0,0 +1,36 @@
+/**
+ * @file CustomerReader.cpp
+ * @brief Implementation of CustomerReader.
+ */
+#include "CustomerReader.h"
+#include <cctype>
+#include <exception>
+
+// True if the line holds nothing but whitespace
+static bool isBlank(const std::string& line) {
+    for (char c : line) {
+        if (!std::isspace(static_cast<unsigned char>(c))) return false;
+    }
+    return true;
+}
+
+CustomerReader::CustomerReader(std::istream& in) : in_(in), records_(0), malformed_(0) {}
+
+bool CustomerReader::read(Customer& customer) {
+    while (std::getline(in_, line_)) {
+        if (isBlank(line_)) continue;
+        try {
+            customer.parseTSV(line_);
+        } catch (const std::exception&) {
+            ++malformed_;
+            continue;
+        }
+        ++records_;
+        return true;
+    }
+    return false;
+}
+
+std::size_t CustomerReader::recordsRead() const { return records_; }
+
+std::size_t CustomerReader::malformedLines() const { return malformed_; }
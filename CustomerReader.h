@@ -0,0 +1,49 @@
+/**
+ * @file CustomerReader.h
+ * @brief Streams Customer records out of a TSV source with reusable buffers.
+ */
+#ifndef CUSTOMER_READER_H
+#define CUSTOMER_READER_H
+
+#include <cstddef>
+#include <istream>
+#include <string>
+#include "Customer.h"
+
+/**
+ * @brief Reads one Customer per TSV line, parsing into a caller-owned object.
+ *
+ * The reader keeps a single line buffer for its whole life and Customer::parseTSV
+ * splits into a fixed array of field views, so a loop like
+ *
+ *     CustomerReader reader(fin);
+ *     Customer c;
+ *     while (reader.read(c)) list.putItem(c);
+ *
+ * allocates only when a line or a field is longer than any seen before.
+ * Blank lines are skipped; malformed lines are skipped and counted.
+ */
+class CustomerReader {
+public:
+    explicit CustomerReader(std::istream& in);
+
+    /**
+     * @brief Parses the next valid record into @p customer.
+     * @return false once the input is exhausted (@p customer is then untouched).
+     */
+    bool read(Customer& customer);
+
+    /// @brief Number of records parsed so far.
+    std::size_t recordsRead() const;
+
+    /// @brief Number of non-blank lines skipped because they did not parse.
+    std::size_t malformedLines() const;
+
+private:
+    std::istream& in_;
+    std::string   line_;
+    std::size_t   records_;
+    std::size_t   malformed_;
+};
+
+#endif // CUSTOMER_READER_H
@@ -0,0 +1,284 @@
+/**
+ * @file IndexedCustomerList.h
+ * @brief A customer list with secondary indexes kept in step with every change.
+ *
+ *     IndexedCustomerList<> customers;
+ *     customers.addIndex(CustomerField::Email, IndexKind::Hash);          // O(1) equality
+ *     customers.addIndex(CustomerField::PostalCode, IndexKind::Ordered);  // O(log n) ranges
+ *     customers.addIndex(CustomerField::CreditScore, IndexKind::Ordered);
+ *
+ *     customers.putItem(c);
+ *     auto byMail = customers.findEqual(CustomerField::Email, "jane@doe.com");
+ *     auto zips   = customers.findRange(CustomerField::PostalCode, "97000", "97999");
+ *     auto good   = customers.findRange(CustomerField::CreditScore, 750, 850);
+ *
+ * The records live in a LinkedADTList, whose nodes never move, so an index
+ * entry can point straight at its record. Text keys are string_views into
+ * the record itself, so indexing a field copies no characters. putItem,
+ * deleteItem and makeEmpty update every index. Each index keeps a handle per
+ * record, so taking a record out of an index costs O(1) (amortized for
+ * Ordered) however many records share its value. Records are only reachable
+ * as const, because changing an indexed field in place would leave the
+ * indexes stale. To change a record, delete it and put the new version.
+ */
+#ifndef INDEXED_CUSTOMER_LIST_H
+#define INDEXED_CUSTOMER_LIST_H
+
+#include <cmath>
+#include <cstddef>
+#include <functional>
+#include <map>
+#include <stdexcept>
+#include <string>
+#include <string_view>
+#include <type_traits>
+#include <unordered_map>
+#include <vector>
+#include "Customer.h"
+#include "CustomerField.h"
+#include "LinkedADTList.h"
+
+/// @brief Hash indexes answer equality in O(1); ordered ones also answer ranges in O(log n).
+enum class IndexKind { Hash, Ordered };
+
+/**
+ * @tparam KeyEqual Primary key of deleteItem()/getItem(), as in LinkedADTList.
+ */
+template <typename KeyEqual = std::equal_to<Customer>>
+class IndexedCustomerList {
+public:
+    IndexedCustomerList() = default;
+
+    // Copies get their own records, so their indexes are rebuilt over them
+    IndexedCustomerList(const IndexedCustomerList& other) : items_(other.items_) {
+        for (const HashIndex& h : other.hash_) addIndex(h.field, IndexKind::Hash);
+        for (const TextIndex& t : other.text_) addIndex(t.field, IndexKind::Ordered);
+        for (const NumberIndex& n : other.number_) addIndex(n.field, IndexKind::Ordered);
+    }
+
+    IndexedCustomerList& operator=(const IndexedCustomerList& other) {
+        if (this != &other) {
+            IndexedCustomerList copy(other);
+            *this = std::move(copy);
+        }
+        return *this;
+    }
+
+    // Moving hands over the nodes themselves, so index pointers stay valid
+    IndexedCustomerList(IndexedCustomerList&&) noexcept = default;
+    IndexedCustomerList& operator=(IndexedCustomerList&&) noexcept = default;
+
+    // ---------- Indexes ----------
+    /**
+     * @brief Declares an index on @p field and builds it over the current records.
+     *
+     * Hash indexes take text fields. Ordered indexes take text or numeric
+     * fields. Declaring an index that already exists does nothing.
+     * @throws std::invalid_argument for date fields, for a Hash index on a
+     *         numeric field, or for an Ordered numeric index while a record
+     *         holds NaN in that field (NaN has no place in the order).
+     */
+    void addIndex(CustomerField field, IndexKind kind) {
+        if (hasIndex(field, kind)) return;
+        if (kind == IndexKind::Hash) {
+            if (!isTextField(field)) throw std::invalid_argument("Hash indexes need a text field");
+            hash_.push_back(HashIndex{field, {}, {}});
+            for (auto it = items_.begin(); it != items_.end(); ++it) hash_.back().add(&*it);
+        } else if (isTextField(field)) {
+            text_.push_back(TextIndex{field, {}, {}});
+            for (auto it = items_.begin(); it != items_.end(); ++it) text_.back().add(&*it);
+        } else if (isNumericField(field)) {
+            for (auto it = items_.begin(); it != items_.end(); ++it) rejectNaN(*it, field);
+            number_.push_back(NumberIndex{field, {}, {}});
+            for (auto it = items_.begin(); it != items_.end(); ++it) number_.back().add(&*it);
+        } else {
+            throw std::invalid_argument("Date fields cannot be indexed");
+        }
+    }
+
+    bool hasIndex(CustomerField field, IndexKind kind) const {
+        if (kind == IndexKind::Hash) return findIndex(hash_, field) != nullptr;
+        return findIndex(text_, field) != nullptr || findIndex(number_, field) != nullptr;
+    }
+
+    // ---------- List ops (every index follows) ----------
+    /**
+     * @brief Adds @p item and indexes it.
+     * @throws std::invalid_argument if a field with an Ordered numeric index is NaN.
+     */
+    void putItem(const Customer& item) {
+        for (const NumberIndex& n : number_) rejectNaN(item, n.field);
+        items_.putItem(item);
+        const Customer* added = &*items_.begin(); // putItem links at the head
+        for (HashIndex& h : hash_)     h.add(added);
+        for (TextIndex& t : text_)     t.add(added);
+        for (NumberIndex& n : number_) n.add(added);
+    }
+
+    /// @brief Removes the first record equal to @p key under KeyEqual.
+    bool deleteItem(const Customer& key) {
+        typename List::Iterator pos = items_.find(key);
+        if (pos == items_.end()) return false;
+        const Customer* victim = &*pos;
+        for (HashIndex& h : hash_)     h.remove(victim);
+        for (TextIndex& t : text_)     t.remove(victim);
+        for (NumberIndex& n : number_) n.remove(victim);
+        items_.erase(pos);
+        return true;
+    }
+
+    bool getItem(const Customer& key, Customer& found_item) const { return items_.getItem(key, found_item); }
+
+    void makeEmpty() {
+        for (HashIndex& h : hash_)     h.clear();
+        for (TextIndex& t : text_)     t.clear();
+        for (NumberIndex& n : number_) n.clear();
+        items_.makeEmpty();
+    }
+
+    int getLength() const { return items_.getLength(); }
+
+    bool isFull() const { return items_.isFull(); }
+
+    /// @brief Calls @p visit(const Customer&) for every record, newest first.
+    template <typename Visitor>
+    void forEach(Visitor visit) const {
+        for (auto it = mutableItems().begin(); it != mutableItems().end(); ++it) visit(static_cast<const Customer&>(*it));
+    }
+
+    // ---------- Lookups ----------
+    /**
+     * @brief Every record whose text @p field equals @p value.
+     *
+     * O(1) with a Hash index, O(log n) with an Ordered one, and a full scan
+     * when the field has no index.
+     * @throws std::invalid_argument if @p field is not a text field.
+     */
+    std::vector<const Customer*> findEqual(CustomerField field, std::string_view value) const {
+        if (!isTextField(field)) throw std::invalid_argument("findEqual needs a text field");
+        std::vector<const Customer*> out;
+        if (const HashIndex* h = findIndex(hash_, field)) {
+            auto group = h->groups.find(value);
+            if (group != h->groups.end()) out = group->second;
+        } else if (const TextIndex* t = findIndex(text_, field)) {
+            auto range = t->map.equal_range(value);
+            for (auto it = range.first; it != range.second; ++it) out.push_back(it->second);
+        } else {
+            forEach([&](const Customer& c) { if (textField(c, field) == value) out.push_back(&c); });
+        }
+        return out;
+    }
+
+    /**
+     * @brief Records whose text @p field lies in [@p lo, @p hi], in key order.
+     * @throws std::logic_error if @p field has no Ordered index.
+     */
+    std::vector<const Customer*> findRange(CustomerField field, std::string_view lo, std::string_view hi) const {
+        const TextIndex* t = findIndex(text_, field);
+        if (!t) throw std::logic_error("findRange needs an Ordered index on the field");
+        return collect(t->map.lower_bound(lo), t->map.upper_bound(hi), lo <= hi);
+    }
+
+    /**
+     * @brief Records whose numeric @p field lies in [@p lo, @p hi], in key order.
+     * @throws std::logic_error if @p field has no Ordered index.
+     */
+    std::vector<const Customer*> findRange(CustomerField field, double lo, double hi) const {
+        const NumberIndex* n = findIndex(number_, field);
+        if (!n) throw std::logic_error("findRange needs an Ordered index on the field");
+        return collect(n->map.lower_bound(lo), n->map.upper_bound(hi), lo <= hi);
+    }
+
+private:
+    using List = LinkedADTList<Customer, KeyEqual>;
+
+    // Records grouped by value. slot remembers each record's place in its
+    // group, so remove() is a swap-and-pop rather than a scan of the group.
+    struct HashIndex {
+        CustomerField field;
+        std::unordered_map<std::string_view, std::vector<const Customer*>> groups;
+        std::unordered_map<const Customer*, std::size_t> slot;
+
+        void add(const Customer* c) {
+            std::vector<const Customer*>& group = groups[textField(*c, field)];
+            slot[c] = group.size();
+            group.push_back(c);
+        }
+
+        void remove(const Customer* c) {
+            const std::string_view value = textField(*c, field);
+            auto group = groups.find(value);
+            auto pos = slot.find(c);
+            std::vector<const Customer*>& members = group->second;
+            const Customer* moved = members.back();
+            members[pos->second] = moved;
+            slot[moved] = pos->second;
+            members.pop_back();
+            slot.erase(pos);
+            if (members.empty()) {
+                groups.erase(group);
+            } else if (group->first.data() == value.data()) {
+                // the key viewed c's own field; point it at a record that stays
+                auto node = groups.extract(group);
+                node.key() = textField(*node.mapped().front(), field);
+                groups.insert(std::move(node));
+            }
+        }
+
+        void clear() { groups.clear(); slot.clear(); }
+    };
+
+    // multimap iterators stay valid until their entry is erased, so each
+    // record keeps the iterator to its entry.
+    template <typename Key>
+    struct OrderedIndex {
+        using Map = std::multimap<Key, const Customer*>;
+        CustomerField field;
+        Map map;
+        std::unordered_map<const Customer*, typename Map::iterator> entry;
+
+        void add(const Customer* c) {
+            if constexpr (std::is_same_v<Key, double>) entry.emplace(c, map.emplace(numericField(*c, field), c));
+            else                                        entry.emplace(c, map.emplace(textField(*c, field), c));
+        }
+
+        void remove(const Customer* c) {
+            auto e = entry.find(c);
+            map.erase(e->second);
+            entry.erase(e);
+        }
+
+        void clear() { map.clear(); entry.clear(); }
+    };
+    using TextIndex = OrderedIndex<std::string_view>;
+    using NumberIndex = OrderedIndex<double>;
+
+    List                     items_;
+    std::vector<HashIndex>   hash_;
+    std::vector<TextIndex>   text_;
+    std::vector<NumberIndex> number_;
+
+    // LinkedADTList has no const iteration; nothing reached through this is modified
+    List& mutableItems() const { return const_cast<List&>(items_); }
+
+    template <typename Index>
+    static const Index* findIndex(const std::vector<Index>& indexes, CustomerField field) {
+        for (const Index& index : indexes) if (index.field == field) return &index;
+        return nullptr;
+    }
+
+    // NaN compares false both ways, which would break the multimap's ordering
+    static void rejectNaN(const Customer& c, CustomerField field) {
+        if (std::isnan(numericField(c, field)))
+            throw std::invalid_argument("NaN cannot go into an Ordered index");
+    }
+
+    template <typename It>
+    static std::vector<const Customer*> collect(It first, It last, bool nonEmpty) {
+        std::vector<const Customer*> out;
+        if (nonEmpty) for (; first != last; ++first) out.push_back(first->second);
+        return out;
+    }
+};
+
+#endif // INDEXED_CUSTOMER_LIST_H
@@ -0,0 +1,168 @@
+/**
+ * @file IntrusiveADTList.h
+ * @brief Intrusive unordered list: elements carry their own links.
+ *
+ * The list never allocates and never copies an element. An element type opts
+ * in by deriving from IntrusiveListHook<Tag>; deriving from several hooks with
+ * different tags lets one object sit in several lists at once:
+ *
+ *     struct ByState {};
+ *     struct ByCity {};
+ *     struct PooledCustomer : IntrusiveListHook<ByState>, IntrusiveListHook<ByCity> {
+ *         Customer customer;
+ *     };
+ *     IntrusiveADTList<PooledCustomer, ByState> byState;
+ *     IntrusiveADTList<PooledCustomer, ByCity>  byCity;
+ *
+ * The list does not own its elements: they must stay alive (and must not be
+ * moved) while linked, and should be removed before they are destroyed.
+ */
+#ifndef INTRUSIVE_ADT_LIST_H
+#define INTRUSIVE_ADT_LIST_H
+
+#include <stdexcept>
+
+/**
+ * @brief Link hook embedded in an element through inheritance.
+ * @tparam Tag Distinguishes the hooks of an element that lives in several lists.
+ *
+ * Copying an element does not copy its list membership: a copied hook starts
+ * out unlinked.
+ */
+template <typename Tag = void>
+class IntrusiveListHook {
+public:
+    IntrusiveListHook() : prev_(nullptr), next_(nullptr) {}
+    IntrusiveListHook(const IntrusiveListHook&) : prev_(nullptr), next_(nullptr) {}
+    IntrusiveListHook& operator=(const IntrusiveListHook&) { return *this; }
+
+    /// @brief Returns true while the element is in a list through this hook.
+    bool isLinked() const { return next_ != nullptr; }
+
+private:
+    template <typename, typename> friend class IntrusiveADTList;
+
+    IntrusiveListHook* prev_;
+    IntrusiveListHook* next_;
+};
+
+/**
+ * @brief Doubly linked, circular list threaded through IntrusiveListHook<Tag>.
+ * @tparam T   Element type; must derive from IntrusiveListHook<Tag>.
+ * @tparam Tag Selects which of T's hooks this list uses.
+ */
+template <typename T, typename Tag = void>
+class IntrusiveADTList {
+private:
+    using Hook = IntrusiveListHook<Tag>;
+
+    Hook head_; // sentinel: head_.next_ is the first element, head_.prev_ the last
+    int  length_;
+
+    static T* owner(Hook* h) { return static_cast<T*>(h); }
+    static Hook* hookOf(T& item) { return static_cast<Hook*>(&item); }
+
+public:
+    // ---------- Iterator -----------
+    class Iterator {
+        friend class IntrusiveADTList;
+        Hook* cur_;
+        const Hook* end_;
+        Iterator(Hook* cur, const Hook* end) : cur_(cur), end_(end) {}
+    public:
+        T& operator*() const {
+            if (cur_ == end_) throw std::out_of_range("Iterator at end");
+            return *owner(cur_);
+        }
+        Iterator& operator++() { if (cur_ != end_) cur_ = cur_->next_; return *this; }
+        bool operator==(const Iterator& rhs) const { return cur_ == rhs.cur_; }
+        bool operator!=(const Iterator& rhs) const { return !(*this == rhs); }
+    };
+
+    // ---------- Ctors / dtor ----------
+    IntrusiveADTList() : length_(0) { head_.prev_ = head_.next_ = &head_; }
+
+    // Elements can only be linked into one list per hook, so no copies
+    IntrusiveADTList(const IntrusiveADTList&) = delete;
+    IntrusiveADTList& operator=(const IntrusiveADTList&) = delete;
+
+    /// @brief Unlinks every element; the elements themselves are untouched.
+    ~IntrusiveADTList() { makeEmpty(); }
+
+    // ---------- Basic ops ----------
+    /**
+     * @brief Links @p item at the front of the list. O(1), no allocation.
+     * @throws std::logic_error if @p item is already linked through this hook.
+     */
+    void putItem(T& item) {
+        Hook* h = hookOf(item);
+        if (h->isLinked()) throw std::logic_error("Item is already in a list");
+        h->prev_ = &head_;
+        h->next_ = head_.next_;
+        head_.next_->prev_ = h;
+        head_.next_ = h;
+        ++length_;
+    }
+
+    /**
+     * @brief Unlinks @p item from the list in O(1); @p item is not destroyed.
+     *
+     * @p item must be in this list or not linked at all.
+     * @return false if @p item was not linked.
+     */
+    bool deleteItem(T& item) {
+        Hook* h = hookOf(item);
+        if (!h->isLinked()) return false;
+        unlink(h);
+        return true;
+    }
+
+    /**
+     * @brief Finds the first element equal to @p key.
+     * @param found_item Set to the element itself (not a copy) when found.
+     */
+    bool getItem(const T& key, T*& found_item) const {
+        for (Hook* h = head_.next_; h != &head_; h = h->next_) {
+            if (*owner(h) == key) { found_item = owner(h); return true; }
+        }
+        return false;
+    }
+
+    /// @brief Unlinks every element without destroying any of them.
+    void makeEmpty() {
+        Hook* h = head_.next_;
+        while (h != &head_) {
+            Hook* nxt = h->next_;
+            h->prev_ = h->next_ = nullptr;
+            h = nxt;
+        }
+        head_.prev_ = head_.next_ = &head_;
+        length_ = 0;
+    }
+
+    bool isFull() const { return false; } // elements bring their own storage
+
+    int getLength() const { return length_; }
+
+    // ---------- Iteration ----------
+    Iterator begin() { return Iterator(head_.next_, &head_); }
+    Iterator end()   { return Iterator(&head_, &head_); }
+
+    /// @brief Unlinks the element @p pos points at; returns the next position.
+    Iterator erase(Iterator pos) {
+        if (pos.cur_ == &head_) return end();
+        Hook* next = pos.cur_->next_;
+        unlink(pos.cur_);
+        return Iterator(next, &head_);
+    }
+
+private:
+    void unlink(Hook* h) {
+        h->prev_->next_ = h->next_;
+        h->next_->prev_ = h->prev_;
+        h->prev_ = h->next_ = nullptr;
+        --length_;
+    }
+};
+
+#endif // INTRUSIVE_ADT_LIST_H
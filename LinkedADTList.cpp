@@ -3,35 +3,100 @@
  * @brief Implementation of LinkedADTList methods.
  */
 #include "LinkedADTList.h"
+#include <algorithm> // std::reverse
 #include <string> // for explicit instantiation
+#include "Customer.h"
+#include "CustomerComparators.h"
 
 // ----- helpers ------
-template <typename T>
-void LinkedADTList<T>::copyFrom(const LinkedADTList<T>& other) {
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::copyFrom(const LinkedADTList<T, KeyEqual>& other) {
     head_ = nullptr;
+    tail_ = nullptr;
     length_ = 0;
 
     Node* src = other.head_;
     Node** tail = &head_;
     while (src) {
         *tail = new Node(src->data);
+        tail_ = *tail;
         tail = &((*tail)->next);
         src = src->next;
         ++length_;
     }
+
+    // Same index settings as other; the entries are rebuilt on first use
+    skipRequested_ = other.skipRequested_;
+    skipStride_ = other.skipStride_;
+    skip_.clear();
+    skipLead_ = 0;
+    skipDirty_ = skipStride_ > 0;
+}
+
+// Take over other's chain and leave it empty (no allocation)
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::stealFrom(LinkedADTList<T, KeyEqual>& other) {
+    head_ = other.head_;
+    tail_ = other.tail_;
+    length_ = other.length_;
+    ++version_;
+    other.forgetNodes();
+    invalidateSkipIndex();
+}
+
+// Drop the chain without deleting it (its nodes now belong elsewhere)
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::forgetNodes() {
+    head_ = nullptr;
+    tail_ = nullptr;
+    length_ = 0;
+    ++version_;
+    skip_.clear();
+    skipLead_ = 0;
+    skipDirty_ = false;
+}
+
+// Place an express entry on every skipStride_-th node, counted from the head
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::rebuildSkipIndex() {
+    if (skipRequested_ > 0) {
+        skipStride_ = skipRequested_;
+    } else {
+        int stride = 8;
+        while (stride * stride < length_) stride *= 2;
+        skipStride_ = stride;
+    }
+
+    skip_.clear();
+    skip_.reserve(length_ / skipStride_ + 1);
+    int pos = 0;
+    for (Node* cur = head_; cur; cur = cur->next, ++pos) {
+        if (pos % skipStride_ == 0) skip_.push_back(SkipEntry{cur, 0});
+        ++skip_.back().span;
+    }
+    std::reverse(skip_.begin(), skip_.end()); // tail-first
+    skipLead_ = 0;
+    skipDirty_ = false;
 }
 
 // ----- Big Three -----
-template <typename T>
-LinkedADTList<T>::LinkedADTList() : head_(nullptr), length_(0) {}
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>::LinkedADTList() : head_(nullptr), tail_(nullptr), length_(0) {}
 
-template <typename T>
-LinkedADTList<T>::LinkedADTList(const LinkedADTList& other) : head_(nullptr), length_(0) {
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>::LinkedADTList(const LinkedADTList& other) : head_(nullptr), tail_(nullptr), length_(0) {
     copyFrom(other);
 }
 
-template <typename T>
-LinkedADTList<T>& LinkedADTList<T>::operator=(const LinkedADTList& other) {
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>::LinkedADTList(LinkedADTList&& other) noexcept : head_(nullptr), tail_(nullptr), length_(0) {
+    skipRequested_ = other.skipRequested_;
+    skipStride_ = other.skipStride_;
+    stealFrom(other);
+}
+
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>& LinkedADTList<T, KeyEqual>::operator=(const LinkedADTList& other) {
     if (this != &other) {
         makeEmpty();
         copyFrom(other);
@@ -39,30 +104,64 @@ LinkedADTList<T>& LinkedADTList<T>::operator=(const LinkedADTList& other) {
     return *this;
 }
 
-template <typename T>
-LinkedADTList<T>::~LinkedADTList() {
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>& LinkedADTList<T, KeyEqual>::operator=(LinkedADTList&& other) noexcept {
+    if (this != &other) {
+        makeEmpty();
+        skipRequested_ = other.skipRequested_;
+        skipStride_ = other.skipStride_;
+        stealFrom(other);
+    }
+    return *this;
+}
+
+template <typename T, typename KeyEqual>
+LinkedADTList<T, KeyEqual>::~LinkedADTList() {
     makeEmpty();
 }
 
 // ----- Core ops -----
-template <typename T>
-void LinkedADTList<T>::putItem(const T& item) {
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::putItem(const T& item) {
     Node* n = new Node(item);
     n->next = head_;
     head_ = n;
+    if (!tail_) tail_ = n;
     ++length_;
+
+    // New heads accumulate in the lead; every stride-th one becomes an entry
+    if (skipStride_ && !skipDirty_ && ++skipLead_ >= skipStride_) {
+        skip_.push_back(SkipEntry{head_, skipLead_});
+        skipLead_ = 0;
+        // an automatic stride is re-chosen once the list outgrows it
+        if (skipRequested_ == 0 && skip_.size() > 2 * static_cast<std::size_t>(skipStride_))
+            skipDirty_ = true;
+    }
 }
 
-template <typename T>
-bool LinkedADTList<T>::deleteItem(const T& item) {
+template <typename T, typename KeyEqual>
+bool LinkedADTList<T, KeyEqual>::deleteItem(const T& item) {
     Node* cur = head_;
     Node* prev = nullptr;
+    // j is the express entry whose segment cur is in (skip_.size() = the lead)
+    const bool track = skipStride_ && !skipDirty_;
+    std::size_t j = skip_.size();
     while (cur) {
-        if (cur->data == item) {
+        prefetch(cur->next); // fetch the next node while comparing this one
+        if (track && j > 0 && skip_[j - 1].node == cur) --j;
+        if (KeyEqual{}(cur->data, item)) {
             if (prev) prev->next = cur->next;
             else      head_ = cur->next;
+            if (cur == tail_) tail_ = prev;
+            if (track) {
+                if (j == skip_.size())         --skipLead_;
+                else if (skip_[j].node != cur) --skip_[j].span;
+                else if (skip_[j].span > 1)    { skip_[j].node = cur->next; --skip_[j].span; }
+                else                           skip_.erase(skip_.begin() + j);
+            }
             delete cur;
             --length_;
+            ++version_;
             return true;
         }
         prev = cur;
@@ -71,23 +170,23 @@ bool LinkedADTList<T>::deleteItem(const T& item) {
     return false;
 }
 
-template <typename T>
-void LinkedADTList<T>::makeEmpty() {
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::makeEmpty() {
     Node* cur = head_;
     while (cur) {
         Node* nxt = cur->next;
         delete cur;
         cur = nxt;
     }
-    head_ = nullptr;
-    length_ = 0;
+    forgetNodes();
 }
 
-template <typename T>
-bool LinkedADTList<T>::getItem(const T& key, T& found_item) const {
+template <typename T, typename KeyEqual>
+bool LinkedADTList<T, KeyEqual>::getItem(const T& key, T& found_item) const {
     Node* cur = head_;
     while (cur) {
-        if (cur->data == key) {
+        prefetch(cur->next); // fetch the next node while comparing this one
+        if (KeyEqual{}(cur->data, key)) {
             found_item = cur->data;
             return true;
         }
@@ -96,99 +195,132 @@ bool LinkedADTList<T>::getItem(const T& key, T& found_item) const {
     return false;
 }
 
-// ----- Queries -----
-template <typename T>
-int LinkedADTList<T>::getLength() const {
-    return length_;
-}
-
-template <typename T>
-bool LinkedADTList<T>::isFull() const {
-    return false; // linked list limited only by memory
+template <typename T, typename KeyEqual>
+typename LinkedADTList<T, KeyEqual>::Iterator LinkedADTList<T, KeyEqual>::find(const T& key) {
+    Node* prev = nullptr;
+    for (Node* cur = head_; cur; prev = cur, cur = cur->next) {
+        prefetch(cur->next); // fetch the next node while comparing this one
+        if (KeyEqual{}(cur->data, key)) return Iterator(prev, cur, version_);
+    }
+    return end();
 }
 
-// ----- Explicit instantiations for test types -----
-template class LinkedADTList<int>;
-template class LinkedADTList<std::string>;
+template <typename T, typename KeyEqual>
+typename LinkedADTList<T, KeyEqual>::Iterator LinkedADTList<T, KeyEqual>::erase(Iterator pos) {
+    Node* victim = pos.cur;
+    if (!victim) return end();
 
-template <typename T>
-void LinkedADTList<T>::destroyAll() {
-    Node* cur = head_;
-    while (cur) {
-        Node* tmp = cur;
-        cur = cur->next;
-        delete tmp;
+    // The remembered predecessor is only safe to read if nothing was freed or
+    // relinked since pos was made; otherwise find it again from the head
+    Node* prev = pos.version == version_ ? pos.prev : nullptr;
+    if (victim == head_) {
+        prev = nullptr;
+    } else if (!prev || prev->next != victim) {
+        prev = head_;
+        while (prev && prev->next != victim) prev = prev->next;
+        if (!prev) return end(); // not a node of this list
     }
-    head_ = nullptr;
-    length_ = 0;
-}
 
-template <typename T>
-void LinkedADTList<T>::copyFrom(const LinkedADTList& other) {
-    if (!other.head_) { head_ = nullptr; length_ = 0; return; }
-    head_ = new Node(other.head_->data);
-    Node* src = other.head_->next;
-    Node* tail = head_;
-    while (src) {
-        tail->next = new Node(src->data);
-        tail = tail->next;
-        src = src->next;
-    }
-    length_ = other.length_;
+    if (prev) prev->next = victim->next;
+    else      head_ = victim->next;
+    if (victim == tail_) tail_ = prev;
+    Node* next = victim->next;
+    delete victim;
+    --length_;
+    ++version_;
+    invalidateSkipIndex(); // the erased node may have been an express entry
+    return Iterator(prev, next, version_);
 }
 
-template <typename T>
-LinkedADTList<T>::LinkedADTList(const LinkedADTList& other)
-    : head_(nullptr), length_(0) {
-    copyFrom(other);
+// ----- Whole-list ops -----
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::splice(LinkedADTList&& other) {
+    if (this == &other || !other.head_) return;
+    if (!head_) { stealFrom(other); return; }
+
+    // other's tail now points at our old head
+    other.tail_->next = head_;
+    head_ = other.head_;
+    length_ += other.length_;
+    ++version_;
+    other.forgetNodes();
+    invalidateSkipIndex();
 }
 
-template <typename T>
-LinkedADTList<T>& LinkedADTList<T>::operator=(const LinkedADTList& other) {
-    if (this != &other) {
-        destroyAll();
-        copyFrom(other);
-    }
-    return *this;
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::concat(LinkedADTList&& other) {
+    if (this == &other || !other.head_) return;
+    if (!head_) { stealFrom(other); return; }
+
+    // our tail now points at other's head
+    tail_->next = other.head_;
+    tail_ = other.tail_;
+    length_ += other.length_;
+    ++version_;
+    other.forgetNodes();
+    invalidateSkipIndex();
 }
 
-template <typename T>
-LinkedADTList<T>::~LinkedADTList() {
-    destroyAll();
+// ----- Express index -----
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::enableSkipIndex(int stride) {
+    skipRequested_ = stride > 0 ? stride : 0;
+    rebuildSkipIndex();
 }
 
-template <typename T>
-void LinkedADTList<T>::putItem(const T& item) {
-    Node* n = new Node(item, head_);
-    head_ = n;
-    ++length_;
+template <typename T, typename KeyEqual>
+void LinkedADTList<T, KeyEqual>::disableSkipIndex() {
+    std::vector<SkipEntry>().swap(skip_);
+    skipRequested_ = 0;
+    skipStride_ = 0;
+    skipLead_ = 0;
+    skipDirty_ = false;
 }
 
-template <typename T>
-bool LinkedADTList<T>::deleteItem(const T& key) {
-    Node* prev = nullptr;
-    Node* cur  = head_;
-    while (cur) {
-        if (cur->data == key) {
-            if (prev) prev->next = cur->next; else head_ = cur->next;
-            delete cur;
-            --length_;
-            return true;
+template <typename T, typename KeyEqual>
+typename LinkedADTList<T, KeyEqual>::Iterator LinkedADTList<T, KeyEqual>::seek(int index) {
+    if (index < 0 || index >= length_) return end();
+    if (skipDirty_) rebuildSkipIndex();
+
+    Node* cur = head_;
+    int pos = 0;
+    if (skipStride_ && index >= skipLead_) {
+        // hop entry to entry (head-most first) until the target's segment
+        pos = skipLead_;
+        for (std::size_t k = skip_.size(); k-- > 0; ) {
+            if (index < pos + skip_[k].span) { cur = skip_[k].node; break; }
+            pos += skip_[k].span;
         }
-        prev = cur;
+    }
+    while (pos < index) {
         cur = cur->next;
+        ++pos;
     }
-    return false;
+    return Iterator(cur);
 }
 
-template <typename T>
-bool LinkedADTList<T>::getItem(const T& key, T& out) const {
-    for (Node* cur = head_; cur; cur = cur->next) {
-        if (cur->data == key) { out = cur->data; return true; }
-    }
-    return false;
+// ----- Queries -----
+template <typename T, typename KeyEqual>
+int LinkedADTList<T, KeyEqual>::getLength() const {
+    return length_;
 }
 
-// Explicit instantiations for common test types
+template <typename T, typename KeyEqual>
+bool LinkedADTList<T, KeyEqual>::isFull() const {
+    return false; // linked list limited only by memory
+}
+
+// ----- Explicit instantiations for test types -----
 template class LinkedADTList<int>;
 template class LinkedADTList<std::string>;
+template class LinkedADTList<Customer>;
+
+// One list type per fixed Customer key
+template class LinkedADTList<Customer, CustomerEqual<FullName>>;
+template class LinkedADTList<Customer, CustomerEqual<UserName>>;
+template class LinkedADTList<Customer, CustomerEqual<CustomerID>>;
+template class LinkedADTList<Customer, CustomerEqual<CustomerSince>>;
+template class LinkedADTList<Customer, CustomerEqual<DateOfBirth>>;
+template class LinkedADTList<Customer, CustomerEqual<CreditScore>>;
+template class LinkedADTList<Customer, CustomerEqual<HouseholdIncome>>;
+template class LinkedADTList<Customer, CustomerEqual<TotalSales>>;
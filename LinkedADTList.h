@@ -2,9 +2,25 @@
 #define LINKED_ADT_LIST_H
 
 #include <cstddef>
+#include <functional> // std::less, std::equal_to
+#include <stdexcept>
 #include <string>
+#include <vector>
 
-template <typename T>
+// Software prefetch of the next node while the current one is compared.
+// Define LINKED_ADT_LIST_NO_PREFETCH to compile the hints out.
+#if defined(LINKED_ADT_LIST_NO_PREFETCH) || !(defined(__GNUC__) || defined(__clang__))
+#define LINKED_ADT_LIST_PREFETCH(addr) ((void)(addr))
+#else
+#define LINKED_ADT_LIST_PREFETCH(addr) __builtin_prefetch((addr), 0, 3)
+#endif
+
+/**
+ * @tparam KeyEqual Stateless predicate that decides which node find(),
+ *         getItem() and deleteItem() match (default: operator==). Only the
+ *         combinations instantiated in LinkedADTList.cpp link.
+ */
+template <typename T, typename KeyEqual = std::equal_to<T>>
 class LinkedADTList {
 private:
     struct Node {
@@ -13,40 +29,202 @@ private:
         Node(const T& d) : data(d), next(nullptr) {}
     };
 
+    // Start pulling the node (and the payload stored in it) into cache.
+    // Prefetching a null pointer is harmless, so callers need not check.
+    static void prefetch(const Node* n) { LINKED_ADT_LIST_PREFETCH(n); }
+
 public:
     /**
      *
      */
     class Iterator {
     public:
-        explicit Iterator(Node* ptr) : cur(ptr) {}
-        T& operator*() { return cur->data; }
-        Iterator& operator++() { cur = cur->next; return *this; }
+        explicit Iterator(Node* ptr) : prev(nullptr), cur(ptr), version(0) {}
+        T& operator*() {
+            if (!cur) throw std::out_of_range("Iterator at end");
+            return cur->data;
+        }
+        Iterator& operator++() {
+            if (!cur) return *this; // end() stays at the end
+            prev = cur;
+            cur = cur->next;
+            if (cur) prefetch(cur->next); // overlap the next hop with the loop body
+            return *this;
+        }
+        bool operator==(const Iterator& other) const { return cur == other.cur; }
         bool operator!=(const Iterator& other) const { return cur != other.cur; }
     private:
+        friend class LinkedADTList;
+        Iterator(Node* before, Node* ptr, unsigned long ver) : prev(before), cur(ptr), version(ver) {}
+
+        Node* prev; // node before cur, remembered so erase() needs no rescan
         Node* cur;
+        unsigned long version; // list's version_ when prev was recorded
     };
 
     LinkedADTList();
     LinkedADTList(const LinkedADTList& other);
+    LinkedADTList(LinkedADTList&& other) noexcept;
     LinkedADTList& operator=(const LinkedADTList& other);
+    LinkedADTList& operator=(LinkedADTList&& other) noexcept;
     ~LinkedADTList();
 
     void putItem(const T& item);
     bool deleteItem(const T& item);
     void makeEmpty();
     bool getItem(const T& key, T& found_item) const;
+
+    /**
+     * @brief Returns an iterator to the first item equal to @p key, or end().
+     *
+     * The iterator remembers its predecessor, so erase() on it is O(1).
+     */
+    Iterator find(const T& key);
+
+    /**
+     * @brief Removes the item @p pos points at.
+     *
+     * O(1) for iterators that came from find(), begin() or erase() (or were
+     * advanced with ++ from one) when the list has not been changed since.
+     * After a deleteItem(), erase(), sort(), splice(), concat() or makeEmpty()
+     * the remembered predecessor may be gone, so erase() looks it up again
+     * instead of reading it; so do positions from seek(). @p pos itself
+     * must still be in this list.
+     * @return Iterator to the item that followed the erased one.
+     */
+    Iterator erase(Iterator pos);
+
     int getLength() const;
     bool isFull() const;
 
-    Iterator begin() { return Iterator(head_); }
+    /**
+     * @brief Moves every node of @p other to the front of this list in O(1).
+     *
+     * No node is allocated or copied; @p other is left empty.
+     */
+    void splice(LinkedADTList&& other);
+
+    /**
+     * @brief Moves every node of @p other to the back of this list in O(1).
+     *
+     * Uses the tail pointer, so combining N lists costs N pointer writes.
+     * @p other is left empty.
+     */
+    void concat(LinkedADTList&& other);
+
+    /**
+     * @brief Sorts the list in place with a bottom-up merge sort.
+     *
+     * Relinks the existing nodes: O(n log n) compares, no allocation and no
+     * payload copies. Stable. With the default comparator a
+     * LinkedADTList<Customer> is ordered by Customer::getCompareWith().
+     * @param comp Strict weak ordering, called as comp(a, b).
+     */
+    template <typename Compare = std::less<T>>
+    void sort(Compare comp = Compare());
+
+    /**
+     * @brief Turns on the express-pointer index used by seek().
+     *
+     * Every @p stride-th node gets an express entry; putItem and deleteItem
+     * keep the entries current. A stride of 0 picks about sqrt(length) when the
+     * index is (re)built, which makes seek() O(sqrt n).
+     */
+    void enableSkipIndex(int stride = 0);
+
+    /// @brief Turns the express-pointer index off and frees it.
+    void disableSkipIndex();
+
+    /// @brief Returns true if the express-pointer index is enabled.
+    bool hasSkipIndex() const { return skipStride_ > 0; }
+
+    /**
+     * @brief Returns an iterator to the item at position @p index (0 = begin()).
+     *
+     * Jumps along the express pointers when the index is enabled, otherwise
+     * walks from the head. Returns end() if @p index is out of range.
+     */
+    Iterator seek(int index);
+
+    Iterator begin() { return Iterator(nullptr, head_, version_); }
     Iterator end() { return Iterator(nullptr); }
 
 private:
+    // Express pointer: a node plus the number of nodes from it up to the next
+    // express node toward the tail.
+    struct SkipEntry {
+        Node* node;
+        int span;
+    };
+
     Node* head_;
+    Node* tail_;
     int length_;
+    unsigned long version_ = 0; // bumped whenever nodes are freed or relinked
+
+    // Express index, ordered tail-first so putItem can push_back new heads.
+    // skipLead_ counts the nodes in front of the head-most entry.
+    std::vector<SkipEntry> skip_;
+    int  skipRequested_ = 0;  // stride asked for (0 = auto)
+    int  skipStride_    = 0;  // stride in effect, 0 when disabled
+    int  skipLead_      = 0;
+    bool skipDirty_     = false;
 
     void copyFrom(const LinkedADTList& other);
+    void stealFrom(LinkedADTList& other);
+    void forgetNodes();
+    void rebuildSkipIndex();
+    void invalidateSkipIndex() { if (skipStride_) skipDirty_ = true; }
 };
 
+// Member template, so it cannot be explicitly instantiated in LinkedADTList.cpp
+template <typename T, typename KeyEqual>
+template <typename Compare>
+void LinkedADTList<T, KeyEqual>::sort(Compare comp) {
+    if (length_ < 2) return;
+
+    // Each pass merges neighbouring sorted runs of `width` nodes into runs of
+    // 2 * width, relinking the chain as it goes.
+    for (std::size_t width = 1; width < static_cast<std::size_t>(length_); width *= 2) {
+        Node* left = head_;
+        Node* merged = nullptr;
+        Node** link = &merged;
+        Node* last = nullptr;
+
+        while (left) {
+            // the right run starts `width` nodes after the left one
+            Node* right = left;
+            std::size_t leftSize = 0;
+            while (leftSize < width && right) {
+                right = right->next;
+                ++leftSize;
+            }
+            std::size_t rightSize = width;
+
+            while (leftSize > 0 || (rightSize > 0 && right)) {
+                Node* pick;
+                // take from the left on ties so equal items keep their order
+                if (leftSize == 0 || (rightSize > 0 && right && comp(right->data, left->data))) {
+                    pick = right;
+                    right = right->next;
+                    --rightSize;
+                } else {
+                    pick = left;
+                    left = left->next;
+                    --leftSize;
+                }
+                *link = pick;
+                link = &pick->next;
+                last = pick;
+            }
+            left = right;
+        }
+        *link = nullptr;
+        head_ = merged;
+        tail_ = last;
+    }
+    ++version_; // predecessors remembered by iterators are stale
+    invalidateSkipIndex(); // positions changed
+}
+
 #endif
@@ -0,0 +1,121 @@
+/**
+ * @file ParallelSort.h
+ * @brief Multi-threaded merge sort for ArrayADTList.
+ *
+ *     parallelSort(numbers);                              // std::less, all cores
+ *     parallelSort(customers);                            // Customer::getCompareWith()
+ *     parallelSort(customers, CustomerLess<CreditScore>(), 16);
+ *
+ * The list is cut into one block per thread, and each block is sorted with
+ * std::sort on its own thread. Sorted runs are then merged pairwise, log2(P)
+ * rounds for P blocks. Every merge in a round is split into pieces at
+ * matching split points (a binary search in the other run), so each round
+ * still keeps all threads busy instead of halving the parallelism. Each
+ * round streams the items between the list and a buffer of the same size.
+ *
+ * The comparator is read concurrently, so the global Customer compare mode
+ * must not change while a sort runs.
+ */
+#ifndef PARALLEL_SORT_H
+#define PARALLEL_SORT_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <iterator>
+#include <thread>
+#include <utility>
+#include <vector>
+#include "ArrayADTList.h"
+
+namespace parallel_sort_detail {
+
+// Below this many items per thread, threads cost more than they save
+constexpr std::size_t MIN_ITEMS_PER_THREAD = 1 << 14;
+
+// Runs task(i) for i in [0, count) on count threads (the caller's included)
+template <typename Task>
+void runTasks(std::size_t count, Task task) {
+    std::vector<std::thread> workers;
+    workers.reserve(count > 0 ? count - 1 : 0);
+    for (std::size_t i = 1; i < count; ++i) workers.emplace_back(task, i);
+    if (count > 0) task(0);
+    for (std::thread& t : workers) t.join();
+}
+
+// Merges the sorted runs [a, a + na) and [b, b + nb) into out, moving the
+// items, as `pieces` independent slices that can run in parallel.
+template <typename T, typename Compare>
+struct MergeJob {
+    T* a; std::size_t na;
+    T* b; std::size_t nb;
+    T* out;
+
+    // Slice k of `pieces`: a left range cut evenly and the matching right range
+    void slice(std::size_t k, std::size_t pieces, Compare& comp) const {
+        std::size_t i0 = na * k / pieces;
+        std::size_t i1 = na * (k + 1) / pieces;
+        // right items strictly less than a[i] precede it; ties keep left first
+        std::size_t j0 = k == 0 ? 0 : static_cast<std::size_t>(std::lower_bound(b, b + nb, a[i0], comp) - b);
+        std::size_t j1 = k + 1 == pieces ? nb
+                                         : static_cast<std::size_t>(std::lower_bound(b, b + nb, a[i1], comp) - b);
+        std::merge(std::make_move_iterator(a + i0), std::make_move_iterator(a + i1),
+                   std::make_move_iterator(b + j0), std::make_move_iterator(b + j1),
+                   out + i0 + j0, comp);
+    }
+};
+
+} // namespace parallel_sort_detail
+
+/**
+ * @brief Sorts @p list in place with @p threads threads.
+ * @param comp    Strict weak ordering, called concurrently as comp(a, b).
+ * @param threads Number of threads; 0 = one per hardware thread. Small
+ *                lists use fewer threads (at least 16K items each).
+ */
+template <typename T, typename KeyEqual, typename Compare = std::less<T>>
+void parallelSort(ArrayADTList<T, KeyEqual>& list, Compare comp = Compare(), unsigned threads = 0) {
+    using namespace parallel_sort_detail;
+
+    const std::size_t n = static_cast<std::size_t>(list.getLength());
+    if (n < 2) return;
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+
+    // Blocks: a power of two, so every merge round pairs the runs up evenly
+    std::size_t blocks = 1;
+    while (blocks * 2 <= threads && n / (blocks * 2) >= MIN_ITEMS_PER_THREAD) blocks *= 2;
+
+    T* items = &*list.begin();
+    if (blocks == 1) {
+        std::sort(items, items + n, comp);
+        return;
+    }
+
+    auto bound = [&](std::size_t block) { return n * block / blocks; };
+    runTasks(blocks, [&](std::size_t i) { std::sort(items + bound(i), items + bound(i + 1), comp); });
+
+    std::vector<T> buffer(n);
+    T* from = items;
+    T* to = buffer.data();
+    for (std::size_t width = 1; width < blocks; width *= 2) {
+        // pair up runs of `width` blocks; split each merge so `blocks` slices run in total
+        std::vector<MergeJob<T, Compare>> jobs;
+        for (std::size_t left = 0; left < blocks; left += 2 * width) {
+            std::size_t lo = bound(left), mid = bound(left + width), hi = bound(left + 2 * width);
+            jobs.push_back(MergeJob<T, Compare>{from + lo, mid - lo, from + mid, hi - mid, to + lo});
+        }
+        const std::size_t piecesPerJob = blocks / jobs.size();
+        runTasks(blocks, [&](std::size_t task) {
+            Compare local = comp;
+            jobs[task / piecesPerJob].slice(task % piecesPerJob, piecesPerJob, local);
+        });
+        std::swap(from, to);
+    }
+    if (from != items) {
+        runTasks(blocks, [&](std::size_t i) {
+            std::move(from + bound(i), from + bound(i + 1), items + bound(i));
+        });
+    }
+}
+
+#endif // PARALLEL_SORT_H
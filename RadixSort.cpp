@@ -0,0 +1,107 @@
+/**
+ * @file RadixSort.cpp
+ * @brief Radix passes and the Customer key mapping.
+ */
+#include "RadixSort.h"
+#include <algorithm>
+#include <stdexcept>
+#include "CustomerComparators.h"
+
+// --- helpers ---
+// Flipping the sign bit makes unsigned order match signed order
+static inline std::uint32_t orderedBits(std::int32_t v) {
+    return static_cast<std::uint32_t>(v) ^ 0x80000000u;
+}
+
+static inline std::uint32_t dateBits(const Date& d) {
+    return orderedBits(d.getYear() * 10000 + d.getMonth() * 100 + d.getDay());
+}
+
+// Sorts keys (and, if given, the row numbers riding along) by one LSD pass
+// per byte that actually varies
+static void radixPasses(std::vector<std::uint32_t>& keys, std::vector<std::uint32_t>* rows) {
+    const std::size_t n = keys.size();
+    if (n < 2) return;
+
+    std::size_t counts[4][256] = {};
+    for (std::uint32_t k : keys) {
+        ++counts[0][k & 0xFF];
+        ++counts[1][(k >> 8) & 0xFF];
+        ++counts[2][(k >> 16) & 0xFF];
+        ++counts[3][k >> 24];
+    }
+
+    std::vector<std::uint32_t> keysOut(n);
+    std::vector<std::uint32_t> rowsOut(rows ? n : 0);
+    for (int pass = 0; pass < 4; ++pass) {
+        const int shift = 8 * pass;
+        std::size_t* count = counts[pass];
+        if (count[(keys[0] >> shift) & 0xFF] == n) continue; // every key has this byte
+
+        std::size_t offset = 0;
+        for (int b = 0; b < 256; ++b) {
+            std::size_t c = count[b];
+            count[b] = offset;
+            offset += c;
+        }
+        for (std::size_t i = 0; i < n; ++i) {
+            std::size_t dst = count[(keys[i] >> shift) & 0xFF]++;
+            keysOut[dst] = keys[i];
+            if (rows) rowsOut[dst] = (*rows)[i];
+        }
+        keys.swap(keysOut);
+        if (rows) rows->swap(rowsOut);
+    }
+}
+
+std::vector<std::uint32_t> radixSortOrder(const std::vector<std::uint32_t>& keys) {
+    std::vector<std::uint32_t> sorted(keys);
+    std::vector<std::uint32_t> order(keys.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<std::uint32_t>(i);
+    radixPasses(sorted, &order);
+    return order;
+}
+
+std::uint32_t radixKey(const Customer& customer, CustomerCompareOptions key) {
+    switch (key) {
+        case CreditScore:     return orderedBits(customer.getCreditScore());
+        case HouseholdIncome: return orderedBits(customer.getHouseholdIncome());
+        case CustomerSince:   return dateBits(customer.getCustomerSince());
+        case DateOfBirth:     return dateBits(customer.getDateOfBirth());
+        default:
+            throw std::invalid_argument("radix sort needs an integer or date key");
+    }
+}
+
+std::vector<std::uint32_t> radixSortOrder(const std::vector<const Customer*>& items, CustomerCompareOptions key) {
+    std::vector<std::uint32_t> keys(items.size());
+    for (std::size_t i = 0; i < items.size(); ++i) keys[i] = radixKey(*items[i], key);
+
+    std::vector<std::uint32_t> order(items.size());
+    for (std::size_t i = 0; i < order.size(); ++i) order[i] = static_cast<std::uint32_t>(i);
+    radixPasses(keys, &order);
+
+    // Tie-break: put each run of equal keys in customer_id order
+    CustomerLess<CustomerID> byId;
+    for (std::size_t begin = 0; begin < keys.size();) {
+        std::size_t end = begin + 1;
+        while (end < keys.size() && keys[end] == keys[begin]) ++end;
+        if (end - begin > 1) {
+            std::sort(order.begin() + begin, order.begin() + end,
+                      [&](std::uint32_t a, std::uint32_t b) { return byId(*items[a], *items[b]); });
+        }
+        begin = end;
+    }
+    return order;
+}
+
+void radixSort(ArrayADTList<int>& list) {
+    std::vector<std::uint32_t> keys;
+    keys.reserve(static_cast<std::size_t>(list.getLength()));
+    for (ArrayADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) keys.push_back(orderedBits(*it));
+    radixPasses(keys, nullptr); // ints carry nothing else, so sort the values directly
+    std::size_t i = 0;
+    for (ArrayADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+        *it = static_cast<std::int32_t>(keys[i++] ^ 0x80000000u);
+    }
+}
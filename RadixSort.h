@@ -0,0 +1,61 @@
+/**
+ * @file RadixSort.h
+ * @brief LSD radix sort of ArrayADTLists on integer and date keys.
+ *
+ * CreditScore, HouseholdIncome, CustomerSince and DateOfBirth are integers
+ * (dates as yyyymmdd), so a list can be ordered by them in a few linear
+ * passes over 32-bit keys instead of O(n log n) calls to threeWayCompare.
+ * The passes sort a permutation of row numbers; the records themselves are
+ * then moved into place once, by ArrayADTList::permute().
+ */
+#ifndef RADIX_SORT_H
+#define RADIX_SORT_H
+
+#include <cstdint>
+#include <vector>
+#include "ArrayADTList.h"
+#include "Customer.h"
+
+/**
+ * @brief Stable LSD radix sort of @p keys (8 bits per pass).
+ *
+ * Passes whose byte is the same for every key are skipped, so small keys
+ * such as credit scores cost two passes, not four.
+ * @return The permutation that sorts @p keys: order[i] is the index of the
+ *         i-th smallest key; equal keys keep their input order.
+ */
+std::vector<std::uint32_t> radixSortOrder(const std::vector<std::uint32_t>& keys);
+
+/**
+ * @brief Maps the @p key field of @p customer to an unsigned integer with the same order.
+ * @throws std::invalid_argument unless @p key is CreditScore, HouseholdIncome,
+ *         CustomerSince or DateOfBirth.
+ */
+std::uint32_t radixKey(const Customer& customer, CustomerCompareOptions key);
+
+/**
+ * @brief Orders the customer rows in @p items by @p key, ties by customer_id.
+ *
+ * Same order as sorting with CustomerLess<key>. Runs of equal keys are put
+ * in customer_id order with a comparison sort over their row numbers.
+ * @return The permutation to hand to ArrayADTList::permute().
+ */
+std::vector<std::uint32_t> radixSortOrder(const std::vector<const Customer*>& items, CustomerCompareOptions key);
+
+/// @brief Sorts @p list ascending in place.
+void radixSort(ArrayADTList<int>& list);
+
+/**
+ * @brief Sorts @p list in place by @p key, ties by customer_id.
+ * @throws std::invalid_argument unless @p key is an integer or date key.
+ */
+template <typename KeyEqual>
+void radixSort(ArrayADTList<Customer, KeyEqual>& list, CustomerCompareOptions key) {
+    std::vector<const Customer*> items;
+    items.reserve(static_cast<std::size_t>(list.getLength()));
+    for (auto it = list.begin(); it != list.end(); ++it) items.push_back(&*it);
+    std::vector<std::uint32_t> order = radixSortOrder(items, key);
+    list.permute(order);
+}
+
+#endif // RADIX_SORT_H
@@ -0,0 +1,261 @@
+/**
+ * @file RcuLinkedADTList.h
+ * @brief Linked unordered list with lock-free readers and a single writer.
+ *
+ * Read-copy-update style: readers walk the chain without locks and without
+ * atomic read-modify-write instructions, the writer publishes every change
+ * with a release store, and unlinked nodes are only freed once every reader
+ * that might still see them has left its read-side section (a grace period).
+ *
+ * Usage:
+ *
+ *     RcuLinkedADTList<int> list;            // owned by the writer thread
+ *     // in each reader thread:
+ *     RcuLinkedADTList<int>::Reader reader = list.registerReader();
+ *     int found;
+ *     reader.getItem(42, found);
+ *
+ * Exactly one thread may call the writer-side methods (putItem, deleteItem,
+ * makeEmpty, synchronize, reclaim). Readers must be destroyed before the list.
+ */
+#ifndef RCU_LINKED_ADT_LIST_H
+#define RCU_LINKED_ADT_LIST_H
+
+#include <atomic>
+#include <cstdint>
+#include <stdexcept>
+#include <thread>
+#include <vector>
+
+template <typename T>
+class RcuLinkedADTList {
+private:
+    struct Node {
+        T data;
+        std::atomic<Node*> next;
+        Node(const T& d, Node* n) : data(d), next(n) {}
+    };
+
+    // One per registered reader, on its own cache line so readers never
+    // write to a line another reader touches. epoch == 0 means quiescent.
+    struct alignas(64) ReaderSlot {
+        std::atomic<std::uint64_t> epoch{0};
+        std::atomic<bool> inUse{false};
+    };
+
+    struct Retired {
+        Node* node;
+        std::uint64_t epoch; // epoch in which the node was unlinked
+    };
+
+public:
+    static constexpr int MAX_READERS = 64;
+
+    // ---------- Iterator (valid only inside a read-side section) ----------
+    class Iterator {
+    public:
+        explicit Iterator(Node* ptr) : cur(ptr) {}
+        const T& operator*() const { return cur->data; }
+        Iterator& operator++() { cur = cur->next.load(std::memory_order_acquire); return *this; }
+        bool operator==(const Iterator& other) const { return cur == other.cur; }
+        bool operator!=(const Iterator& other) const { return cur != other.cur; }
+    private:
+        Node* cur;
+    };
+
+    /**
+     * @brief A reader thread's handle; obtain one with registerReader().
+     *
+     * lock()/unlock() bracket a read-side section (so std::lock_guard works);
+     * they only store to the reader's own slot. Sections must not nest.
+     */
+    class Reader {
+    public:
+        Reader(Reader&& other) noexcept : list_(other.list_), slot_(other.slot_) { other.slot_ = nullptr; }
+        Reader(const Reader&) = delete;
+        Reader& operator=(const Reader&) = delete;
+        Reader& operator=(Reader&&) = delete;
+        ~Reader() { if (slot_) slot_->inUse.store(false, std::memory_order_release); }
+
+        void lock() {
+            slot_->epoch.store(list_->epoch_.load(std::memory_order_acquire), std::memory_order_relaxed);
+            // Order the slot store before the loads of the chain; pairs with
+            // the fence in minActiveEpoch(). A fence, not a read-modify-write.
+            std::atomic_thread_fence(std::memory_order_seq_cst);
+        }
+
+        void unlock() { slot_->epoch.store(0, std::memory_order_release); }
+
+        /// @brief Copies the first item equal to @p key into @p found_item.
+        bool getItem(const T& key, T& found_item) {
+            lock();
+            bool found = false;
+            for (Iterator it = list_->begin(); it != list_->end(); ++it) {
+                if (*it == key) { found_item = *it; found = true; break; }
+            }
+            unlock();
+            return found;
+        }
+
+        /// @brief Calls @p visit(item) for every item of one consistent pass.
+        template <typename Visitor>
+        void forEach(Visitor visit) {
+            lock();
+            for (Iterator it = list_->begin(); it != list_->end(); ++it) visit(*it);
+            unlock();
+        }
+
+    private:
+        friend class RcuLinkedADTList;
+        Reader(RcuLinkedADTList* list, ReaderSlot* slot) : list_(list), slot_(slot) {}
+
+        RcuLinkedADTList* list_;
+        ReaderSlot* slot_;
+    };
+
+    // ---------- Ctors / dtor ----------
+    RcuLinkedADTList() : head_(nullptr), length_(0), epoch_(1) {}
+    RcuLinkedADTList(const RcuLinkedADTList&) = delete;
+    RcuLinkedADTList& operator=(const RcuLinkedADTList&) = delete;
+
+    /// @brief Frees every node; no reader may still be registered.
+    ~RcuLinkedADTList() {
+        Node* cur = head_.load(std::memory_order_relaxed);
+        while (cur) {
+            Node* nxt = cur->next.load(std::memory_order_relaxed);
+            delete cur;
+            cur = nxt;
+        }
+        for (const Retired& r : retired_) delete r.node;
+    }
+
+    /**
+     * @brief Claims a reader slot for the calling thread.
+     * @throws std::overflow_error if MAX_READERS readers are registered.
+     */
+    Reader registerReader() {
+        for (ReaderSlot& slot : slots_) {
+            bool expected = false;
+            if (slot.inUse.compare_exchange_strong(expected, true, std::memory_order_acq_rel))
+                return Reader(this, &slot);
+        }
+        throw std::overflow_error("Too many readers");
+    }
+
+    // ---------- Writer-side ops (single writer thread) ----------
+    void putItem(const T& item) {
+        Node* n = new Node(item, head_.load(std::memory_order_relaxed));
+        head_.store(n, std::memory_order_release); // publish a fully built node
+        ++length_;
+    }
+
+    /**
+     * @brief Unlinks the first item equal to @p key.
+     *
+     * The node is freed after a grace period, by a later reclaim() or
+     * synchronize(); readers already standing on it can finish their walk.
+     */
+    bool deleteItem(const T& key) {
+        std::atomic<Node*>* link = &head_;
+        Node* cur = head_.load(std::memory_order_relaxed);
+        while (cur) {
+            Node* nxt = cur->next.load(std::memory_order_relaxed);
+            if (cur->data == key) {
+                link->store(nxt, std::memory_order_release);
+                --length_;
+                retire(cur);
+                return true;
+            }
+            link = &cur->next;
+            cur = nxt;
+        }
+        return false;
+    }
+
+    // Only the writer mutates, so it can read without a read-side section
+    bool getItem(const T& key, T& found_item) const {
+        for (Node* cur = head_.load(std::memory_order_relaxed); cur;
+             cur = cur->next.load(std::memory_order_relaxed)) {
+            if (cur->data == key) { found_item = cur->data; return true; }
+        }
+        return false;
+    }
+
+    /// @brief Unlinks every node at once; they are freed after a grace period.
+    void makeEmpty() {
+        Node* cur = head_.load(std::memory_order_relaxed);
+        head_.store(nullptr, std::memory_order_release);
+        length_ = 0;
+        if (!cur) return;
+        const std::uint64_t e = advanceEpoch();
+        while (cur) {
+            retired_.push_back(Retired{cur, e});
+            cur = cur->next.load(std::memory_order_relaxed);
+        }
+        reclaim();
+    }
+
+    int getLength() const { return length_; }
+
+    bool isFull() const { return false; } // limited only by memory
+
+    /// @brief Frees every retired node no reader can still reach. Never blocks.
+    void reclaim() {
+        const std::uint64_t safe = minActiveEpoch();
+        std::size_t kept = 0;
+        for (const Retired& r : retired_) {
+            if (r.epoch < safe) delete r.node;
+            else retired_[kept++] = r;
+        }
+        retired_.resize(kept);
+    }
+
+    /// @brief Waits for a full grace period, then frees every retired node.
+    void synchronize() {
+        const std::uint64_t target = advanceEpoch() + 1;
+        while (minActiveEpoch() < target) std::this_thread::yield();
+        reclaim();
+    }
+
+    /// @brief Number of unlinked nodes still waiting for a grace period.
+    int pendingReclaims() const { return static_cast<int>(retired_.size()); }
+
+    // ---------- Iteration (inside Reader::lock()/unlock(), or by the writer) ----------
+    Iterator begin() const { return Iterator(head_.load(std::memory_order_acquire)); }
+    Iterator end() const { return Iterator(nullptr); }
+
+private:
+    static constexpr std::size_t RECLAIM_BATCH = 64;
+
+    std::atomic<Node*> head_;
+    int length_;                          // writer only
+    std::atomic<std::uint64_t> epoch_;    // written by the writer only
+    std::vector<Retired> retired_;        // writer only
+    ReaderSlot slots_[MAX_READERS];
+
+    void retire(Node* n) {
+        retired_.push_back(Retired{n, advanceEpoch()});
+        if (retired_.size() >= RECLAIM_BATCH) reclaim();
+    }
+
+    // Starts a new epoch and returns the one that just ended. Readers that
+    // saw the new value also see every unlink published before it.
+    std::uint64_t advanceEpoch() {
+        const std::uint64_t e = epoch_.load(std::memory_order_relaxed);
+        epoch_.store(e + 1, std::memory_order_release);
+        return e;
+    }
+
+    // Oldest epoch any reader is inside; nodes retired before it are safe.
+    std::uint64_t minActiveEpoch() const {
+        std::atomic_thread_fence(std::memory_order_seq_cst); // pairs with Reader::lock()
+        std::uint64_t oldest = epoch_.load(std::memory_order_relaxed);
+        for (const ReaderSlot& slot : slots_) {
+            const std::uint64_t e = slot.epoch.load(std::memory_order_acquire);
+            if (e != 0 && e < oldest) oldest = e;
+        }
+        return oldest;
+    }
+};
+
+#endif // RCU_LINKED_ADT_LIST_H
@@ -0,0 +1,37 @@
+/**
+ * @file StringPool.cpp
+ * @brief Implementation of StringPool.
+ */
+#include "StringPool.h"
+#include <stdexcept>
+
+StringPool::StringPool() {
+    intern(std::string_view()); // symbol 0
+}
+
+StringPool::Symbol StringPool::intern(std::string_view text) {
+    auto it = ids_.find(text);
+    if (it != ids_.end()) return it->second;
+
+    if (strings_.size() >= 0xFFFFFFFFu) throw std::overflow_error("StringPool is full");
+    Symbol symbol = static_cast<Symbol>(strings_.size());
+    strings_.emplace_back(text);
+    ids_.emplace(std::string_view(strings_.back()), symbol); // key views the stored copy
+    return symbol;
+}
+
+bool StringPool::find(std::string_view text, Symbol& symbol) const {
+    auto it = ids_.find(text);
+    if (it == ids_.end()) return false;
+    symbol = it->second;
+    return true;
+}
+
+std::string_view StringPool::view(Symbol symbol) const {
+    if (symbol >= strings_.size()) throw std::out_of_range("Unknown symbol");
+    return strings_[symbol];
+}
+
+std::size_t StringPool::size() const {
+    return strings_.size();
+}
@@ -0,0 +1,50 @@
+/**
+ * @file StringPool.h
+ * @brief Interned string pool: each distinct string is stored once.
+ */
+#ifndef STRING_POOL_H
+#define STRING_POOL_H
+
+#include <cstddef>
+#include <cstdint>
+#include <deque>
+#include <string>
+#include <string_view>
+#include <unordered_map>
+
+/**
+ * @brief Maps strings to dense 32-bit symbol ids and back.
+ *
+ * Interning the same text twice yields the same id, so two interned fields
+ * are equal exactly when their ids are. Views returned by view() stay valid
+ * for the life of the pool. Symbol 0 is always the empty string.
+ *
+ * Not thread-safe: like the list containers, concurrent use needs external
+ * locking (concurrent view() calls alone are fine).
+ */
+class StringPool {
+public:
+    using Symbol = std::uint32_t;
+
+    StringPool();
+    StringPool(const StringPool&) = delete;            // views point into the pool
+    StringPool& operator=(const StringPool&) = delete;
+
+    /// @brief Returns the symbol for @p text, adding it on first sight.
+    Symbol intern(std::string_view text);
+
+    /// @brief Looks @p text up without adding it; returns false if absent.
+    bool find(std::string_view text, Symbol& symbol) const;
+
+    /// @brief The text of @p symbol. @throws std::out_of_range for unknown ids.
+    std::string_view view(Symbol symbol) const;
+
+    /// @brief Number of distinct strings (including the empty string).
+    std::size_t size() const;
+
+private:
+    std::deque<std::string> strings_;  // deque: elements never move, views stay valid
+    std::unordered_map<std::string_view, Symbol> ids_;
+};
+
+#endif // STRING_POOL_H
@@ -0,0 +1,168 @@
+/**
+ * @file TopK.h
+ * @brief The k greatest items of a list or a stream without sorting it.
+ *
+ *     std::vector<Customer> best = topK(customers, 100, TotalSales);
+ *     std::vector<int> largest = topK(numbers, 10, std::less<int>());
+ *
+ *     CustomerReader reader(fin);                    // file larger than memory
+ *     std::vector<Customer> top = topK(reader, 100, CreditScore);
+ *
+ * A bounded min-heap holds the best k items seen so far. Each new item is
+ * compared against the heap's smallest, and only a better item costs an
+ * O(log k) replace. That gives O(n log k) time and O(k) memory. The result is
+ * ordered best first. Customer keys use CustomerLess<Key>, so ties go to
+ * the greater customer_id and the result is deterministic.
+ */
+#ifndef TOP_K_H
+#define TOP_K_H
+
+#include <algorithm>
+#include <cstddef>
+#include <functional>
+#include <stdexcept>
+#include <thread>
+#include <type_traits>
+#include <vector>
+#include "ArrayADTList.h"
+#include "Customer.h"
+#include "CustomerComparators.h"
+#include "CustomerReader.h"
+
+/**
+ * @brief Streaming top-k: push items one at a time, read the best k at any point.
+ * @tparam Compare Strict weak ordering; "greater" items under it win.
+ */
+template <typename T, typename Compare = std::less<T>>
+class TopKAccumulator {
+public:
+    // The heap grows as items arrive, so a huge k ("all") costs nothing up front
+    explicit TopKAccumulator(std::size_t k, Compare comp = Compare()) : k_(k), comp_(comp) {}
+
+    /// @brief Pre-sizes the heap for @p count upcoming items; never more than k.
+    void reserve(std::size_t count) { heap_.reserve(std::min(k_, count)); }
+
+    /// @brief Offers @p item; it is copied only if it makes the current top k.
+    void push(const T& item) {
+        if (heap_.size() < k_) {
+            heap_.push_back(item);
+            std::push_heap(heap_.begin(), heap_.end(), worseFirst());
+        } else if (k_ > 0 && comp_(heap_.front(), item)) {
+            std::pop_heap(heap_.begin(), heap_.end(), worseFirst());
+            heap_.back() = item; // assignment reuses the evicted item's storage
+            std::push_heap(heap_.begin(), heap_.end(), worseFirst());
+        }
+    }
+
+    /// @brief Folds in the items kept by @p other (e.g. another thread's accumulator).
+    void merge(const TopKAccumulator& other) {
+        for (const T& item : other.heap_) push(item);
+    }
+
+    /// @brief Number of items kept, min(k, items pushed).
+    std::size_t size() const { return heap_.size(); }
+
+    /// @brief The kept items, best first.
+    std::vector<T> result() const {
+        std::vector<T> out(heap_);
+        std::sort(out.begin(), out.end(), [this](const T& a, const T& b) { return comp_(b, a); });
+        return out;
+    }
+
+private:
+    // Heap order whose front is the worst kept item
+    auto worseFirst() const {
+        return [this](const T& a, const T& b) { return comp_(b, a); };
+    }
+
+    std::size_t    k_;
+    Compare        comp_;
+    std::vector<T> heap_;
+};
+
+/// @brief The @p k greatest items of @p list under @p comp, best first.
+template <typename List, typename Compare>
+auto topK(List& list, std::size_t k, Compare comp) {
+    using T = std::decay_t<decltype(*list.begin())>;
+    TopKAccumulator<T, Compare> acc(k, comp);
+    acc.reserve(static_cast<std::size_t>(list.getLength()));
+    for (auto it = list.begin(); it != list.end(); ++it) acc.push(*it);
+    return acc.result();
+}
+
+/// @brief The @p k best customers read from @p reader, under @p comp.
+template <typename Compare>
+std::vector<Customer> topK(CustomerReader& reader, std::size_t k, Compare comp) {
+    TopKAccumulator<Customer, Compare> acc(k, comp);
+    Customer current;
+    while (reader.read(current)) acc.push(current);
+    return acc.result();
+}
+
+/**
+ * @brief Parallel top-k over an ArrayADTList: one accumulator per thread, merged.
+ * @param threads 0 = one per hardware thread.
+ */
+template <typename T, typename KeyEqual, typename Compare>
+std::vector<T> parallelTopK(ArrayADTList<T, KeyEqual>& list, std::size_t k, Compare comp, unsigned threads = 0) {
+    const std::size_t n = static_cast<std::size_t>(list.getLength());
+    if (threads == 0) threads = std::max(1u, std::thread::hardware_concurrency());
+    if (threads > n / 4096 + 1) threads = static_cast<unsigned>(n / 4096 + 1); // >= 4K items each
+
+    std::vector<TopKAccumulator<T, Compare>> partial(threads, TopKAccumulator<T, Compare>(k, comp));
+    auto scan = [&](unsigned t) {
+        auto first = list.begin() + static_cast<std::ptrdiff_t>(n * t / threads);
+        auto last = list.begin() + static_cast<std::ptrdiff_t>(n * (t + 1) / threads);
+        partial[t].reserve(static_cast<std::size_t>(last - first));
+        for (auto it = first; it != last; ++it) partial[t].push(*it);
+    };
+    std::vector<std::thread> workers;
+    for (unsigned t = 1; t < threads; ++t) workers.emplace_back(scan, t);
+    scan(0);
+    for (std::thread& w : workers) w.join();
+
+    for (unsigned t = 1; t < threads; ++t) partial[0].merge(partial[t]);
+    return partial[0].result();
+}
+
+// ---------- By CustomerCompareOptions key ----------
+
+namespace top_k_detail {
+
+// Calls fn(CustomerLess<key>()) for the runtime key
+template <typename Fn>
+auto withCustomerLess(CustomerCompareOptions key, Fn fn) {
+    switch (key) {
+        case FullName:        return fn(CustomerLess<FullName>());
+        case UserName:        return fn(CustomerLess<UserName>());
+        case CustomerID:      return fn(CustomerLess<CustomerID>());
+        case CustomerSince:   return fn(CustomerLess<CustomerSince>());
+        case DateOfBirth:     return fn(CustomerLess<DateOfBirth>());
+        case CreditScore:     return fn(CustomerLess<CreditScore>());
+        case HouseholdIncome: return fn(CustomerLess<HouseholdIncome>());
+        case TotalSales:      return fn(CustomerLess<TotalSales>());
+    }
+    throw std::invalid_argument("Unknown CustomerCompareOptions value");
+}
+
+} // namespace top_k_detail
+
+/// @brief The @p k customers of @p list with the greatest @p key, best first.
+template <typename List>
+std::vector<Customer> topK(List& list, std::size_t k, CustomerCompareOptions key) {
+    return top_k_detail::withCustomerLess(key, [&](auto less) { return topK(list, k, less); });
+}
+
+/// @brief The @p k customers read from @p reader with the greatest @p key, best first.
+inline std::vector<Customer> topK(CustomerReader& reader, std::size_t k, CustomerCompareOptions key) {
+    return top_k_detail::withCustomerLess(key, [&](auto less) { return topK(reader, k, less); });
+}
+
+/// @brief parallelTopK() by a CustomerCompareOptions key.
+template <typename KeyEqual>
+std::vector<Customer> parallelTopK(ArrayADTList<Customer, KeyEqual>& list, std::size_t k,
+                                   CustomerCompareOptions key, unsigned threads = 0) {
+    return top_k_detail::withCustomerLess(key, [&](auto less) { return parallelTopK(list, k, less, threads); });
+}
+
+#endif // TOP_K_H
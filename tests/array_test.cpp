@@ -2,6 +2,9 @@
 #include "../libs/catch_amalgamated.hpp"
 #include <string.h>
 #include "../ArrayADTList.h"
+#include <algorithm>
+#include <string>
+#include <type_traits>
 
 // Tests for base methods of ArrayADTList
 
@@ -169,3 +172,83 @@ TEST_CASE("getItem should return false on an empty list") {
     int foundItem;
     REQUIRE_FALSE(list.getItem(10, foundItem)); // No items in the list
 }
+
+TEST_CASE("find should return an iterator to the matching item or end()") {
+    ArrayADTList<int> list;
+    list.putItem(10);
+    list.putItem(20);
+    list.putItem(30);
+    ArrayADTList<int>::Iterator it = list.find(20);
+    REQUIRE(it != list.end());
+    REQUIRE(*it == 20);
+    REQUIRE(list.find(40) == list.end());
+}
+
+TEST_CASE("A const list should only hand out const iterators") {
+    ArrayADTList<int> list;
+    list.putItem(10);
+    list.putItem(20);
+    const ArrayADTList<int>& view = list;
+
+    ArrayADTList<int>::ConstIterator it = view.find(20);
+    static_assert(std::is_same<decltype(*it), const int&>::value, "const list must not hand out int&");
+    static_assert(std::is_same<decltype(view.begin()), ArrayADTList<int>::ConstIterator>::value,
+                  "begin() const must return a ConstIterator");
+    REQUIRE(it != view.end());
+    REQUIRE(*it == 20);
+    REQUIRE(view.find(30) == view.end());
+
+    ArrayADTList<int>::ConstIterator first = list.begin(); // Iterator converts
+    REQUIRE(*first == 10);
+    REQUIRE(std::is_sorted(view.begin(), view.end()));
+}
+
+TEST_CASE("erase should remove the found item and keep the order") {
+    ArrayADTList<int> list;
+    list.putItem(10);
+    list.putItem(20);
+    list.putItem(30);
+    ArrayADTList<int>::Iterator next = list.erase(list.find(20));
+    REQUIRE(*next == 30);
+    REQUIRE(list.getLength() == 2);
+    int item;
+    REQUIRE_FALSE(list.getItem(20, item));
+
+    next = list.erase(list.find(30));
+    REQUIRE(next == list.end());
+    REQUIRE(list.erase(list.end()) == list.end());
+    REQUIRE(list.getLength() == 1);
+    REQUIRE(*list.begin() == 10);
+}
+
+TEST_CASE("permute should reorder items by a permutation and reject anything else") {
+    ArrayADTList<std::string> list;
+    const char* words[] = {"a", "b", "c", "d", "e", "f"};
+    for (const char* w : words) list.putItem(std::string(w));
+
+    // two cycles (0 2 4) (1 3) and a fixed point 5
+    list.permute({2, 3, 4, 1, 0, 5});
+    std::string joined;
+    for (ArrayADTList<std::string>::Iterator it = list.begin(); it != list.end(); ++it) joined += *it;
+    REQUIRE(joined == "cdebaf");
+
+    REQUIRE_THROWS_AS(list.permute({0, 1, 2}), std::invalid_argument);
+    REQUIRE_THROWS_AS(list.permute({0, 0, 1, 2, 3, 4}), std::invalid_argument);
+    REQUIRE_THROWS_AS(list.permute({0, 1, 2, 3, 4, 6}), std::invalid_argument);
+}
+
+TEST_CASE("Iterator should be random access so std::sort works on the list") {
+    ArrayADTList<int> list;
+    int values[] = {5, 3, 9, 1, 7};
+    for (int v : values) list.putItem(v);
+
+    ArrayADTList<int>::Iterator first = list.begin();
+    REQUIRE(list.end() - first == 5);
+    REQUIRE(first[2] == 9);
+    REQUIRE(*(first + 4) == 7);
+    REQUIRE(first < list.end());
+
+    std::sort(list.begin(), list.end());
+    REQUIRE(std::is_sorted(list.begin(), list.end()));
+    REQUIRE(*std::lower_bound(list.begin(), list.end(), 6) == 7);
+}
@@ -0,0 +1,139 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../CompactCustomer.h"
+#include "../StringPool.h"
+#include <string>
+
+// Tests for StringPool and CompactCustomer
+
+static Customer makeCustomer(const std::string& id, const std::string& city, const std::string& state) {
+    return Customer(id, "user" + id, "First", "Last", "1 Main St", city, state, "62704",
+                    "a@b.com", "F", "Acme Corporation International", "Senior Software Engineer",
+                    Date(2012, 3, 15), "123-45-6789", Date(1985, 7, 4), 85000, 742, 1234.5);
+}
+
+TEST_CASE("StringPool should hand out one symbol per distinct string") {
+    StringPool pool;
+    REQUIRE(pool.size() == 1);
+    REQUIRE(pool.intern("") == 0);
+
+    StringPool::Symbol a = pool.intern("Springfield");
+    StringPool::Symbol b = pool.intern(std::string("Spring") + "field");
+    StringPool::Symbol c = pool.intern("Shelbyville");
+    REQUIRE(a == b);
+    REQUIRE(a != c);
+    REQUIRE(pool.size() == 3);
+    REQUIRE(pool.view(a) == "Springfield");
+
+    StringPool::Symbol found = 0;
+    REQUIRE(pool.find("Shelbyville", found));
+    REQUIRE(found == c);
+    REQUIRE_FALSE(pool.find("Ogdenville", found));
+    REQUIRE_THROWS_AS(pool.view(99), std::out_of_range);
+}
+
+TEST_CASE("StringPool views should survive later interning") {
+    StringPool pool;
+    std::string_view first = pool.view(pool.intern("a string longer than the small buffer"));
+    for (int i = 0; i < 10000; ++i) pool.intern("city" + std::to_string(i));
+    REQUIRE(first == "a string longer than the small buffer");
+}
+
+TEST_CASE("CompactCustomer should round-trip every field") {
+    StringPool pool;
+    Customer original = makeCustomer("1001", "Springfield", "IL");
+    CompactCustomer compact(original, pool);
+
+    REQUIRE(compact.getCustomerID() == "1001");
+    REQUIRE(compact.getCity() == "Springfield");
+    REQUIRE(compact.getState() == "IL");
+    REQUIRE(compact.getGender() == "F");
+    REQUIRE(compact.getCompany() == "Acme Corporation International");
+    REQUIRE(compact.getJobTitle() == "Senior Software Engineer");
+    REQUIRE(compact.getCreditScore() == 742);
+
+    Customer back = compact.toCustomer();
+    REQUIRE(back.getCustomerID() == "1001");
+    REQUIRE(back.getCity() == "Springfield");
+    REQUIRE(back.getJobTitle() == "Senior Software Engineer");
+    REQUIRE(back.getCustomerSince() == Date(2012, 3, 15));
+    REQUIRE(back.getTotalSales() == Catch::Approx(1234.5));
+}
+
+TEST_CASE("Interned fields should compare by symbol") {
+    StringPool pool;
+    CompactCustomer a(makeCustomer("1", "Springfield", "IL"), pool);
+    CompactCustomer b(makeCustomer("2", "Springfield", "OR"), pool);
+    REQUIRE(a.getCitySymbol() == b.getCitySymbol());
+    REQUIRE(a.getState() != b.getState());
+    REQUIRE(a.getCompanySymbol() == b.getCompanySymbol());
+    REQUIRE(sizeof(CompactCustomer) < sizeof(Customer));
+}
+
+TEST_CASE("Default CompactCustomer should have empty interned fields") {
+    CompactCustomer c;
+    REQUIRE(c.getCity().empty());
+    REQUIRE(c.getCitySymbol() == 0);
+}
+
+TEST_CASE("Packed fields should print back exactly as they were read") {
+    StringPool pool;
+    Customer original = makeCustomer("000123", "Springfield", "IL");
+    original.setPostalCode("02134-0042");
+    original.setSocialSecurityNumber("012345678");
+    CompactCustomer compact(original, pool);
+
+    REQUIRE(compact.getCustomerID() == "000123");
+    REQUIRE(compact.getCustomerIDValue() == 123);
+    REQUIRE(compact.getState() == "IL");
+    REQUIRE(compact.getPostalCode() == "02134-0042");
+    REQUIRE(compact.getSocialSecurityNumber() == "012345678");
+
+    original.setPostalCode("00501");
+    original.setSocialSecurityNumber("001-02-0003");
+    original.setState("");
+    CompactCustomer other(original, pool);
+    REQUIRE(other.getPostalCode() == "00501");
+    REQUIRE(other.getSocialSecurityNumber() == "001-02-0003");
+    REQUIRE(other.getState().empty());
+}
+
+TEST_CASE("CustomerID comparisons should be integer compares") {
+    StringPool pool;
+    CompactCustomer a(makeCustomer("99", "X", "IL"), pool);
+    CompactCustomer b(makeCustomer("100", "X", "IL"), pool);
+    CompactCustomer c(makeCustomer("100", "Y", "OR"), pool);
+    REQUIRE(b.compareCustomerID(a) < 0); // string order: "100" < "99"
+    REQUIRE(a.compareCustomerID(b) > 0);
+    REQUIRE(b.compareCustomerID(c) == 0);
+}
+
+TEST_CASE("CustomerID order should match Customer's CustomerID order") {
+    const char* ids[] = {"10", "9", "07", "7", "123", "45", "1", "100", "0", "00",
+                         "9999999999999999999", "1000000000000000000"};
+    StringPool pool;
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    Customer::setCompareWith(CustomerID);
+    for (const char* x : ids) {
+        for (const char* y : ids) {
+            Customer cx = makeCustomer(x, "X", "IL"), cy = makeCustomer(y, "X", "IL");
+            int expected = cx < cy ? -1 : cy < cx ? 1 : 0;
+            CAPTURE(x, y);
+            REQUIRE(CompactCustomer(cx, pool).compareCustomerID(CompactCustomer(cy, pool)) == expected);
+        }
+    }
+    Customer::setCompareWith(saved);
+}
+
+TEST_CASE("Records that do not fit the packed formats should be rejected") {
+    StringPool pool;
+    Customer bad = makeCustomer("A-17", "X", "IL");
+    REQUIRE_FALSE(CompactCustomer::fits(bad));
+    REQUIRE_THROWS_AS(CompactCustomer(bad, pool), std::invalid_argument);
+
+    Customer longState = makeCustomer("17", "X", "Illinois");
+    REQUIRE_FALSE(CompactCustomer::fits(longState));
+    Customer badZip = makeCustomer("17", "X", "IL");
+    badZip.setPostalCode("1234");
+    REQUIRE_THROWS_AS(CompactCustomer(badZip, pool), std::invalid_argument);
+    REQUIRE(CompactCustomer::fits(makeCustomer("17", "X", "IL")));
+}
@@ -0,0 +1,108 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../CompactLinkedADTList.h"
+#include <set>
+#include <string>
+
+// Tests for CompactLinkedADTList
+
+TEST_CASE("New compact list should be empty") {
+    CompactLinkedADTList<int> list;
+    REQUIRE(list.getLength() == 0);
+    REQUIRE_FALSE(list.isFull());
+    REQUIRE(list.begin() == list.end());
+    REQUIRE_THROWS_AS(*list.end(), std::out_of_range);
+}
+
+TEST_CASE("Compact list should put, get and delete items") {
+    CompactLinkedADTList<int> list;
+    for (int i = 0; i < 5; ++i) list.putItem(i);
+    REQUIRE(list.getLength() == 5);
+
+    int item;
+    REQUIRE(list.getItem(3, item));
+    REQUIRE(item == 3);
+    REQUIRE(list.deleteItem(3));
+    REQUIRE_FALSE(list.getItem(3, item));
+    REQUIRE_FALSE(list.deleteItem(3));
+    REQUIRE(list.deleteItem(4)); // head
+    REQUIRE(list.deleteItem(0)); // tail
+    REQUIRE(list.getLength() == 2);
+
+    std::set<int> seen;
+    for (CompactLinkedADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+        seen.insert(*it);
+    }
+    REQUIRE(seen == std::set<int>{1, 2});
+}
+
+TEST_CASE("Deleted slots should be reused by later inserts") {
+    CompactLinkedADTList<std::string> list;
+    list.putItem("a");
+    list.putItem("b");
+    list.putItem("c");
+    list.deleteItem("b");
+    list.putItem("d");
+    list.putItem("e");
+    REQUIRE(list.getLength() == 4);
+
+    std::set<std::string> seen;
+    for (CompactLinkedADTList<std::string>::Iterator it = list.begin(); it != list.end(); ++it) {
+        seen.insert(*it);
+    }
+    REQUIRE(seen == std::set<std::string>{"a", "c", "d", "e"});
+}
+
+TEST_CASE("Copies of a compact list should be independent") {
+    CompactLinkedADTList<int> list;
+    for (int i = 0; i < 100; ++i) list.putItem(i);
+    CompactLinkedADTList<int> copy = list;
+    list.deleteItem(42);
+    int item;
+    REQUIRE_FALSE(list.getItem(42, item));
+    REQUIRE(copy.getItem(42, item));
+    REQUIRE(copy.getLength() == 100);
+
+    CompactLinkedADTList<int> assigned;
+    assigned.putItem(-1);
+    assigned = list;
+    REQUIRE_FALSE(assigned.getItem(-1, item));
+    REQUIRE(assigned.getLength() == 99);
+}
+
+TEST_CASE("makeEmpty should clear the compact list") {
+    CompactLinkedADTList<int> list;
+    list.reserve(10);
+    for (int i = 0; i < 10; ++i) list.putItem(i);
+    list.makeEmpty();
+    REQUIRE(list.getLength() == 0);
+    REQUIRE(list.begin() == list.end());
+    list.putItem(7);
+    REQUIRE(*list.begin() == 7);
+}
+
+TEST_CASE("A moved-from compact list should be empty and reusable") {
+    CompactLinkedADTList<int> list;
+    for (int i = 0; i < 5; ++i) list.putItem(i);
+    list.deleteItem(2); // leave a slot on the free list
+
+    CompactLinkedADTList<int> moved(std::move(list));
+    REQUIRE(moved.getLength() == 4);
+    REQUIRE(list.getLength() == 0);
+    REQUIRE(list.begin() == list.end());
+
+    list.putItem(3);
+    REQUIRE(list.getLength() == 1);
+    REQUIRE(*list.begin() == 3);
+
+    CompactLinkedADTList<int> assigned;
+    assigned.putItem(-1);
+    assigned = std::move(moved);
+    REQUIRE(assigned.getLength() == 4);
+    REQUIRE(moved.getLength() == 0);
+    moved.putItem(9);
+    std::set<int> seen;
+    for (CompactLinkedADTList<int>::Iterator it = moved.begin(); it != moved.end(); ++it) {
+        seen.insert(*it);
+    }
+    REQUIRE(seen == std::set<int>{9});
+}
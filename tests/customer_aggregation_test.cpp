@@ -0,0 +1,80 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../CustomerAggregation.h"
+#include "../LinkedADTList.h"
+#include <map>
+#include <random>
+#include <string>
+#include <utility>
+#include <vector>
+
+// Tests for CustomerAggregation
+
+static Customer makeCustomer(int id, const std::string& state, const std::string& company, int score, double sales) {
+    return Customer(std::to_string(id), "user", "First", "Last", "1 Main St", "City", state, "62704",
+                    "a@b.com", "F", company, "Job", Date(2012, 3, 15), "123-45-6789", Date(1985, 7, 4),
+                    85000, score, sales);
+}
+
+TEST_CASE("Aggregation should count, sum, min, max and average per group") {
+    LinkedADTList<Customer> list;
+    list.putItem(makeCustomer(1, "IL", "Acme", 700, 10.0));
+    list.putItem(makeCustomer(2, "OR", "Acme", 600, 5.0));
+    list.putItem(makeCustomer(3, "IL", "Initech", 800, 30.0));
+
+    CustomerAggregation query;
+    query.groupBy(CustomerField::State).measure(CustomerField::TotalSales).measure(CustomerField::CreditScore);
+    std::vector<CustomerGroup> groups = query.run(list);
+
+    REQUIRE(groups.size() == 2);
+    REQUIRE(groups[0].key == std::vector<std::string>{"IL"});
+    REQUIRE(groups[0].count == 2);
+    REQUIRE(groups[0].measures[0].sum == Catch::Approx(40.0));
+    REQUIRE(groups[0].measures[0].min == Catch::Approx(10.0));
+    REQUIRE(groups[0].measures[0].max == Catch::Approx(30.0));
+    REQUIRE(groups[0].measures[1].average() == Catch::Approx(750.0));
+    REQUIRE(groups[1].key == std::vector<std::string>{"OR"});
+    REQUIRE(groups[1].count == 1);
+}
+
+TEST_CASE("Parallel aggregation should match a single-threaded reference") {
+    const char* states[] = {"IL", "OR", "TX", "CA", "NY"};
+    const char* companies[] = {"Acme", "Initech", "Globex"};
+    std::mt19937 rng(12);
+    const int n = 100000;
+    ArrayADTList<Customer> list(n);
+    std::map<std::pair<std::string, std::string>, std::pair<std::size_t, long long>> expected;
+    for (int i = 0; i < n; ++i) {
+        std::string state = states[rng() % 5], company = companies[rng() % 3];
+        int score = 300 + static_cast<int>(rng() % 551);
+        list.putItem(makeCustomer(i, state, company, score, 1.0));
+        auto& e = expected[{state, company}];
+        ++e.first;
+        e.second += score;
+    }
+
+    CustomerAggregation query;
+    query.groupBy(CustomerField::State).groupBy(CustomerField::Company).measure(CustomerField::CreditScore);
+    for (unsigned threads : {1u, 2u, 7u}) {
+        std::vector<CustomerGroup> groups = query.runParallel(list, threads);
+        REQUIRE(groups.size() == expected.size());
+        auto want = expected.begin();
+        for (const CustomerGroup& g : groups) {
+            REQUIRE(g.key == std::vector<std::string>{want->first.first, want->first.second});
+            REQUIRE(g.count == want->second.first);
+            REQUIRE(g.measures[0].sum == Catch::Approx(static_cast<double>(want->second.second)));
+            ++want;
+        }
+    }
+}
+
+TEST_CASE("Aggregation should validate its fields and handle empty input") {
+    CustomerAggregation query;
+    REQUIRE_THROWS_AS(query.groupBy(CustomerField::CreditScore), std::invalid_argument);
+    REQUIRE_THROWS_AS(query.groupBy(CustomerField::DateOfBirth), std::invalid_argument);
+    REQUIRE_THROWS_AS(query.measure(CustomerField::City), std::invalid_argument);
+
+    ArrayADTList<Customer> empty;
+    query.groupBy(CustomerField::City).measure(CustomerField::HouseholdIncome);
+    REQUIRE(query.runParallel(empty).empty());
+    REQUIRE(AggregateStats().average() == 0.0);
+}
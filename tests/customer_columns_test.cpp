@@ -0,0 +1,103 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../ArrayADTList.h"
+#include "../CustomerColumns.h"
+#include <climits>
+#include <cmath>
+#include <random>
+#include <vector>
+
+// Tests for CustomerColumns and SelectionBitmap
+
+static Customer makeCustomer(int i, int score, int income, double sales, Date since, Date dob) {
+    return Customer(std::to_string(i), "user", "First", "Last", "1 Main St", "City", "ST", "62704",
+                    "a@b.com", "F", "Co", "Job", since, "123-45-6789", dob, income, score, sales);
+}
+
+// Rows [0, n) whose value passes pred, the answer selectRange must give
+template <typename Pred>
+static std::vector<std::uint32_t> expectedRows(std::size_t n, Pred pred) {
+    std::vector<std::uint32_t> rows;
+    for (std::size_t i = 0; i < n; ++i) if (pred(i)) rows.push_back(static_cast<std::uint32_t>(i));
+    return rows;
+}
+
+TEST_CASE("CustomerColumns should snapshot a list in iteration order") {
+    ArrayADTList<Customer> list(3);
+    list.putItem(makeCustomer(1, 700, 50000, 10.0, Date(2010, 5, 6), Date(1980, 1, 2)));
+    list.putItem(makeCustomer(2, 810, 150000, 20.0, Date(2015, 12, 31), Date(1990, 7, 4)));
+    list.putItem(makeCustomer(3, 640, 90000, 30.0, Date(2001, 1, 1), Date(1975, 3, 9)));
+    CustomerColumns columns(list);
+
+    REQUIRE(columns.size() == 3);
+    REQUIRE(columns.creditScores() == std::vector<std::int32_t>{700, 810, 640});
+    REQUIRE(columns.customerSince()[1] == 20151231);
+    REQUIRE(columns.datesOfBirth()[2] == CustomerColumns::dateKey(Date(1975, 3, 9)));
+}
+
+TEST_CASE("selectRange should match a scalar filter on every column and length") {
+    std::mt19937 rng(99);
+    for (std::size_t n : {0u, 1u, 63u, 64u, 65u, 200u, 1000u}) {
+        CustomerColumns columns;
+        for (std::size_t i = 0; i < n; ++i) {
+            columns.append(makeCustomer(static_cast<int>(i), 300 + static_cast<int>(rng() % 551),
+                                        static_cast<int>(rng() % 300000), (rng() % 10000) / 4.0,
+                                        Date(1990 + rng() % 30, 1 + rng() % 12, 1 + rng() % 28),
+                                        Date(1940 + rng() % 60, 1 + rng() % 12, 1 + rng() % 28)));
+        }
+        INFO("rows: " << n);
+        const auto& score = columns.creditScores();
+        const auto& income = columns.householdIncomes();
+        const auto& sales = columns.totalSales();
+        const auto& since = columns.customerSince();
+
+        SelectionBitmap hits = columns.selectRange(CreditScore, 700, 800);
+        REQUIRE(hits.toSelection() == expectedRows(n, [&](std::size_t i) { return score[i] >= 700 && score[i] <= 800; }));
+        REQUIRE(hits.count() == hits.toSelection().size());
+
+        hits &= columns.selectRange(HouseholdIncome, 100001, INT_MAX);
+        REQUIRE(hits.toSelection() == expectedRows(n, [&](std::size_t i) {
+            return score[i] >= 700 && score[i] <= 800 && income[i] > 100000;
+        }));
+
+        REQUIRE(columns.selectRange(TotalSales, 100.25, 900.5).toSelection() ==
+                expectedRows(n, [&](std::size_t i) { return sales[i] >= 100.25 && sales[i] <= 900.5; }));
+
+        int from = CustomerColumns::dateKey(Date(2000, 1, 1));
+        int to = CustomerColumns::dateKey(Date(2009, 12, 31));
+        REQUIRE(columns.selectRange(CustomerSince, from, to).toSelection() ==
+                expectedRows(n, [&](std::size_t i) { return since[i] >= from && since[i] <= to; }));
+    }
+}
+
+TEST_CASE("selectRange should handle inclusive, fractional, empty and out-of-range bounds") {
+    CustomerColumns columns;
+    int scores[] = {INT_MIN, -5, 0, 700, 701, INT_MAX};
+    for (int s : scores) columns.append(makeCustomer(0, s, 0, std::nan(""), Date(), Date()));
+
+    REQUIRE(columns.selectRange(CreditScore, 700, 700).toSelection() == std::vector<std::uint32_t>{3});
+    REQUIRE(columns.selectRange(CreditScore, 699.5, 700.9).toSelection() == std::vector<std::uint32_t>{3});
+    REQUIRE(columns.selectRange(CreditScore, -1e300, 1e300).count() == 6);
+    REQUIRE(columns.selectRange(CreditScore, 3e9, 4e9).count() == 0);
+    REQUIRE(columns.selectRange(CreditScore, 800, 700).count() == 0);
+    REQUIRE(columns.selectRange(CreditScore, 700.2, 700.8).count() == 0);
+    REQUIRE(columns.selectRange(TotalSales, -1e300, 1e300).count() == 0); // NaN never matches
+    REQUIRE_THROWS_AS(columns.selectRange(UserName, 0, 1), std::invalid_argument);
+}
+
+TEST_CASE("SelectionBitmap should combine only equal-sized bitmaps") {
+    SelectionBitmap a(70), b(70), c(10);
+    a.set(64);
+    a.set(65);
+    b.set(65);
+    REQUIRE_THROWS_AS(b.set(70), std::out_of_range);
+    REQUIRE(b.count() == 1);
+    a |= b;
+    REQUIRE(a.toSelection() == std::vector<std::uint32_t>{64, 65});
+    a &= b;
+    REQUIRE(a.toSelection() == std::vector<std::uint32_t>{65});
+    REQUIRE(a.test(65));
+    REQUIRE_FALSE(a.test(64));
+    REQUIRE_THROWS_AS(a.test(a.size()), std::out_of_range);
+    REQUIRE_THROWS_AS(SelectionBitmap().test(0), std::out_of_range);
+    REQUIRE_THROWS_AS(a &= c, std::invalid_argument);
+}
@@ -0,0 +1,94 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../CustomerLoader.h"
+#include <cstdio>
+#include <fstream>
+#include <string>
+
+// Tests for the bulk Customer loaders
+
+// One valid record whose customer id is `id`
+static std::string record(int id) {
+    return std::to_string(id) + "\tuser" + std::to_string(id) + "\tFirst\tLast\t1 Main St\tCity\tST\t"
+           "12345\tu@x.com\tF\tCo\tJob\t01/02/2010\t123-45-6789\t03/04/1980\t50000\t"
+           + std::to_string(300 + id % 500) + "\t" + std::to_string(id) + ".5";
+}
+
+// Writes `contents` to a scratch file and removes it when done
+struct TempFile {
+    std::string path;
+    explicit TempFile(const std::string& contents) : path("customer_loader_test.tsv") {
+        std::ofstream out(path, std::ios::binary);
+        out << contents;
+    }
+    ~TempFile() { std::remove(path.c_str()); }
+};
+
+static std::string manyRecords(int count, const char* eol) {
+    std::string text;
+    for (int i = 0; i < count; ++i) text += record(i) + eol;
+    return text;
+}
+
+TEST_CASE("Parallel loader should keep file order across chunks") {
+    TempFile file(manyRecords(2000, "\n"));
+    for (unsigned threads : {1u, 3u, 8u}) {
+        CustomerLoadOptions options;
+        options.threads = threads;
+        options.minChunkBytes = 1; // force as many chunks as threads
+        CustomerLoadStats stats;
+        ArrayADTList<Customer> list = loadCustomersParallel(file.path, options, &stats);
+
+        REQUIRE(list.getLength() == 2000);
+        REQUIRE(stats.records == 2000);
+        REQUIRE(stats.chunks == threads);
+        int expected = 0;
+        for (ArrayADTList<Customer>::Iterator it = list.begin(); it != list.end(); ++it) {
+            REQUIRE((*it).getCustomerID() == std::to_string(expected++));
+        }
+    }
+}
+
+TEST_CASE("Parallel loader should handle CRLF, blank lines, bad lines and no final newline") {
+    std::string text = manyRecords(50, "\r\n") + "\n\nnot a record\n" + record(50);
+    TempFile file(text);
+    CustomerLoadOptions options;
+    options.threads = 4;
+    options.minChunkBytes = 64;
+    CustomerLoadStats stats;
+    ArrayADTList<Customer> list = loadCustomersParallel(file.path, options, &stats);
+
+    REQUIRE(list.getLength() == 51);
+    REQUIRE(stats.malformedLines == 1);
+    REQUIRE(stats.bytes == text.size());
+}
+
+TEST_CASE("Parallel loader should load an empty file and reject a missing one") {
+    TempFile file("");
+    ArrayADTList<Customer> list = loadCustomersParallel(file.path);
+    REQUIRE(list.getLength() == 0);
+    REQUIRE_THROWS_AS(loadCustomersParallel("does/not/exist.tsv"), std::runtime_error);
+}
+
+TEST_CASE("Mapped loader should return the customers and load statistics") {
+    std::string text = manyRecords(500, "\n") + "\r\n  \nbroken\n" + record(500);
+    TempFile file(text);
+    CustomerLoadResult result = loadCustomersMapped(file.path);
+
+    REQUIRE(result.customers.getLength() == 501);
+    REQUIRE(result.stats.records == 501);
+    REQUIRE(result.stats.malformedLines == 1);
+    REQUIRE(result.stats.bytes == text.size());
+    int expected = 0;
+    for (ArrayADTList<Customer>::Iterator it = result.customers.begin(); it != result.customers.end(); ++it) {
+        REQUIRE((*it).getCustomerID() == std::to_string(expected));
+        REQUIRE((*it).getCreditScore() == 300 + expected % 500);
+        ++expected;
+    }
+}
+
+TEST_CASE("Mapped loader should load an empty file and reject a missing one") {
+    TempFile file("");
+    CustomerLoadResult result = loadCustomersMapped(file.path);
+    REQUIRE(result.customers.getLength() == 0);
+    REQUIRE_THROWS_AS(loadCustomersMapped("does/not/exist.tsv"), std::runtime_error);
+}
@@ -0,0 +1,242 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../Customer.h"
+#include "../CustomerReader.h"
+#include "../CustomerComparators.h"
+#include "../ArrayADTList.h"
+#include <sstream>
+#include <unordered_set>
+#include <string>
+
+// Tests for Customer
+
+static const std::string RECORD =
+    "1001\tjdoe\tJane\tDoe\t12 Elm St\tSpringfield\tIL\t62704\tjane@doe.com\tF\t"
+    "Acme\tEngineer\t03/15/2012\t123-45-6789\t07/04/1985\t85000\t742\t1234.5";
+
+TEST_CASE("Customer should parse every field of a TSV record") {
+    Customer c(RECORD);
+    REQUIRE(c.getCustomerID() == "1001");
+    REQUIRE(c.getUserName() == "jdoe");
+    REQUIRE(c.getFirstName() == "Jane");
+    REQUIRE(c.getLastName() == "Doe");
+    REQUIRE(c.getStreetAddress() == "12 Elm St");
+    REQUIRE(c.getCity() == "Springfield");
+    REQUIRE(c.getState() == "IL");
+    REQUIRE(c.getPostalCode() == "62704");
+    REQUIRE(c.getEmail() == "jane@doe.com");
+    REQUIRE(c.getGender() == "F");
+    REQUIRE(c.getCompany() == "Acme");
+    REQUIRE(c.getJobTitle() == "Engineer");
+    REQUIRE(c.getCustomerSince() == Date(2012, 3, 15));
+    REQUIRE(c.getSocialSecurityNumber() == "123-45-6789");
+    REQUIRE(c.getDateOfBirth() == Date(1985, 7, 4));
+    REQUIRE(c.getHouseholdIncome() == 85000);
+    REQUIRE(c.getCreditScore() == 742);
+    REQUIRE(c.getTotalSales() == Catch::Approx(1234.5));
+}
+
+TEST_CASE("Customer parsing should trim fields and ignore extra columns") {
+    Customer c(" 7 \t u \t A \t B \t s \t c \t ST \t 1 \t e \t M \t co \t j \t 1/2/2000 \t"
+               " ssn \t 12/31/1999 \t +10 \t 600 \t 2.25 \r\textra\tcolumns");
+    REQUIRE(c.getCustomerID() == "7");
+    REQUIRE(c.getFirstName() == "A");
+    REQUIRE(c.getCustomerSince() == Date(2000, 1, 2));
+    REQUIRE(c.getDateOfBirth() == Date(1999, 12, 31));
+    REQUIRE(c.getHouseholdIncome() == 10);
+    REQUIRE(c.getCreditScore() == 600);
+    REQUIRE(c.getTotalSales() == Catch::Approx(2.25));
+}
+
+TEST_CASE("Customer parsing should reject short records and bad dates") {
+    REQUIRE_THROWS_AS(Customer("1\t2\t3"), std::runtime_error);
+    std::string badDate = RECORD;
+    badDate.replace(badDate.find("03/15/2012"), 10, "02/30/2012");
+    REQUIRE_THROWS_AS(Customer(badDate), std::out_of_range);
+}
+
+TEST_CASE("parseTSV should overwrite an existing customer in place") {
+    Customer c(RECORD);
+    std::string other = RECORD;
+    other.replace(0, 4, "2002");
+    other.replace(other.find("Jane"), 4, "Janet");
+    c.parseTSV(other);
+    REQUIRE(c.getCustomerID() == "2002");
+    REQUIRE(c.getFirstName() == "Janet");
+
+    // a bad line leaves the previous values alone
+    REQUIRE_THROWS(c.parseTSV("x"));
+    REQUIRE(c.getCustomerID() == "2002");
+}
+
+TEST_CASE("Getters should be const and return the stored fields without copying") {
+    const Customer c(RECORD);
+    const std::string& id = c.getCustomerID();
+    REQUIRE(&id == &c.getCustomerID());
+    REQUIRE(&c.getUserName() == &c.getUserName());
+    REQUIRE(&c.getSocialSecurityNumber() == &c.getSocialSecurityNumber());
+    REQUIRE(&c.getCustomerSince() == &c.getCustomerSince());
+    REQUIRE(id == "1001");
+}
+
+TEST_CASE("FullName compare should order by last name, then first name, then id") {
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    Customer::setCompareWith(FullName);
+    Customer li(RECORD), lim(RECORD), liAnn(RECORD), liAnn2(RECORD);
+    li.setLastName("Li");       li.setFirstName("Zoe");
+    lim.setLastName("Lim");     lim.setFirstName("Adam");
+    liAnn.setLastName("Li");    liAnn.setFirstName("Ann");
+    liAnn2 = liAnn;             liAnn2.setCustomerID("1002");
+
+    REQUIRE(li < lim);          // shorter last name first, regardless of first name
+    REQUIRE(liAnn < li);
+    REQUIRE(liAnn < liAnn2);
+    REQUIRE(liAnn == Customer(liAnn));
+    REQUIRE(liAnn != liAnn2);
+    Customer::setCompareWith(saved);
+}
+
+TEST_CASE("Default customer should start on 1/1/1970") {
+    Customer c;
+    REQUIRE(c.getCustomerSince() == Date(1970, 1, 1));
+    REQUIRE(c.getDateOfBirth() == Date(1970, 1, 1));
+}
+
+TEST_CASE("operator>> should read customers line by line") {
+    std::istringstream in(RECORD + "\n\n" + RECORD + "\n");
+    Customer c;
+    int count = 0;
+    while (in >> c) ++count;
+    REQUIRE(count == 2);
+    REQUIRE(c.getLastName() == "Doe");
+}
+
+TEST_CASE("operator>> should set failbit on a malformed line") {
+    std::istringstream in("not\ta\trecord\n" + RECORD + "\n");
+    Customer c;
+    REQUIRE_FALSE(in >> c);
+    REQUIRE(c.getCustomerID().empty());
+}
+
+TEST_CASE("CustomerReader should skip blank and malformed lines") {
+    std::istringstream in(RECORD + "\r\n\n   \nbroken line\n" + RECORD + "\n");
+    CustomerReader reader(in);
+    Customer c;
+    int count = 0;
+    while (reader.read(c)) {
+        REQUIRE(c.getCustomerID() == "1001");
+        REQUIRE(c.getTotalSales() == Catch::Approx(1234.5));
+        ++count;
+    }
+    REQUIRE(count == 2);
+    REQUIRE(reader.recordsRead() == 2);
+    REQUIRE(reader.malformedLines() == 1);
+}
+
+TEST_CASE("Per-key comparators should agree with the runtime compare mode") {
+    Customer a(RECORD), b(RECORD);
+    b.setCustomerID("1002");
+    b.setLastName("Able");
+    b.setUserName("zed");
+    b.setCreditScore(600);
+    b.setTotalSales(99.0);
+    b.setDateOfBirth(Date(1990, 1, 1));
+
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    auto check = [&](CustomerCompareOptions mode, bool less, bool lessReversed) {
+        Customer::setCompareWith(mode);
+        REQUIRE((a < b) == less);
+        REQUIRE((b < a) == lessReversed);
+    };
+    check(FullName,        CustomerLess<FullName>()(a, b),        CustomerLess<FullName>()(b, a));
+    check(UserName,        CustomerLess<UserName>()(a, b),        CustomerLess<UserName>()(b, a));
+    check(CustomerID,      CustomerLess<CustomerID>()(a, b),      CustomerLess<CustomerID>()(b, a));
+    check(CustomerSince,   CustomerLess<CustomerSince>()(a, b),   CustomerLess<CustomerSince>()(b, a));
+    check(DateOfBirth,     CustomerLess<DateOfBirth>()(a, b),     CustomerLess<DateOfBirth>()(b, a));
+    check(CreditScore,     CustomerLess<CreditScore>()(a, b),     CustomerLess<CreditScore>()(b, a));
+    check(HouseholdIncome, CustomerLess<HouseholdIncome>()(a, b), CustomerLess<HouseholdIncome>()(b, a));
+    check(TotalSales,      CustomerLess<TotalSales>()(a, b),      CustomerLess<TotalSales>()(b, a));
+    Customer::setCompareWith(saved);
+
+    REQUIRE(CustomerLess<FullName>()(b, a));     // "Able" < "Doe"
+    REQUIRE(CustomerLess<CreditScore>()(b, a));  // 600 < 742
+    REQUIRE(CustomerLess<UserName>()(a, b));     // "jdoe" < "zed"
+    REQUIRE_FALSE(CustomerEqual<CustomerID>()(a, b));
+}
+
+TEST_CASE("ArrayADTList should search with its KeyEqual parameter") {
+    ArrayADTList<Customer, CustomerEqual<UserName>> list(4);
+    Customer a(RECORD), b(RECORD);
+    b.setCustomerID("1002");
+    b.setUserName("zed");
+    list.putItem(a);
+    list.putItem(b);
+
+    Customer found;
+    REQUIRE(list.getItem(b, found));
+    REQUIRE(found.getCustomerID() == "1002");
+    REQUIRE(list.deleteItem(a));
+    REQUIRE(list.getLength() == 1);
+    REQUIRE(list.find(a) == list.end());
+}
+
+TEST_CASE("Cached sort-key prefixes should order exactly like the strings") {
+    // Pairs that differ inside the 8-byte prefix, past it, by length, and in
+    // bytes >= 0x80 (which std::string compares as unsigned)
+    const char* names[] = {"", "A", "Ab", "Abbott", "Abbottsford", "Abbottsfore", "Zed",
+                           "\xC3\x89mile", "abbott", "Abbottsford-Smith"};
+    Customer a(RECORD), b(RECORD);
+    for (const char* x : names) {
+        for (const char* y : names) {
+            a.setUserName(x);
+            b.setUserName(y);
+            int expected = std::string(x).compare(y);
+            int actual = CustomerOrder<UserName>::compare(a, b);
+            INFO(x << " vs " << y);
+            REQUIRE((actual < 0) == (expected < 0));
+            REQUIRE((actual > 0) == (expected > 0));
+        }
+    }
+}
+
+TEST_CASE("Sort-key prefixes should follow every write to the key fields") {
+    Customer a(RECORD), b(RECORD);
+    b.setCustomerID("1002");
+    REQUIRE(CustomerLess<CustomerID>()(a, b));
+    a.setCustomerID("2000");
+    REQUIRE(CustomerLess<CustomerID>()(b, a));
+
+    b.setLastName("Zimmermann");
+    REQUIRE(CustomerLess<FullName>()(a, b));
+    b.parseTSV(RECORD);                 // back to "Doe", id 1001
+    REQUIRE(CustomerLess<FullName>()(b, a));
+    REQUIRE(CustomerEqual<UserName>()(b, Customer(RECORD)));
+
+    Customer copy = b;
+    copy.setLastName("Aaronson");
+    REQUIRE(CustomerLess<FullName>()(copy, b));
+}
+
+TEST_CASE("Customers should hash consistently with equality") {
+    Customer a(RECORD), b(RECORD);
+    REQUIRE(std::hash<Customer>()(a) == std::hash<Customer>()(b));
+    REQUIRE(std::hash<Customer>()(Customer()) == std::hash<Customer>()(Customer()));
+
+    b.setCustomerID("1002");
+    REQUIRE(a.getCustomerIDHash() != b.getCustomerIDHash());
+    REQUIRE(a != b);
+    b.parseTSV(RECORD);
+    REQUIRE(a.getCustomerIDHash() == b.getCustomerIDHash());
+    REQUIRE(a == b);
+
+    std::unordered_set<Customer> all{a, b};
+    REQUIRE(all.size() == 1);
+
+    std::unordered_set<Customer, CustomerHash<UserName>, CustomerEqual<UserName>> logins;
+    Customer other(RECORD);
+    other.setCustomerID("2002");
+    other.setUserName("other");
+    logins.insert(a);
+    logins.insert(other);
+    REQUIRE(logins.size() == 2);
+    REQUIRE(logins.count(Customer(RECORD)) == 1);
+}
@@ -0,0 +1,157 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../IndexedCustomerList.h"
+#include "../CustomerComparators.h"
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+#include <string>
+#include <vector>
+
+// Tests for IndexedCustomerList
+
+static Customer makeCustomer(int id, const std::string& email, const std::string& zip, int score) {
+    return Customer(std::to_string(id), "user" + std::to_string(id), "First", "Last", "1 Main St", "City", "IL", zip,
+                    email, "F", "Acme", "Job", Date(2012, 3, 15), "123-45-6789", Date(1985, 7, 4),
+                    85000, score, 10.0);
+}
+
+static std::vector<std::string> ids(const std::vector<const Customer*>& found) {
+    std::vector<std::string> out;
+    for (const Customer* c : found) out.push_back(c->getCustomerID());
+    std::sort(out.begin(), out.end());
+    return out;
+}
+
+TEST_CASE("Indexes should answer equality and range lookups") {
+    IndexedCustomerList<> list;
+    list.addIndex(CustomerField::Email, IndexKind::Hash);
+    list.addIndex(CustomerField::PostalCode, IndexKind::Ordered);
+    list.addIndex(CustomerField::CreditScore, IndexKind::Ordered);
+    list.putItem(makeCustomer(1, "a@x.com", "60601", 700));
+    list.putItem(makeCustomer(2, "b@x.com", "97201", 650));
+    list.putItem(makeCustomer(3, "a@x.com", "97405", 810));
+
+    REQUIRE(ids(list.findEqual(CustomerField::Email, "a@x.com")) == std::vector<std::string>{"1", "3"});
+    REQUIRE(list.findEqual(CustomerField::Email, "none@x.com").empty());
+    REQUIRE(ids(list.findRange(CustomerField::PostalCode, "97000", "97999")) == std::vector<std::string>{"2", "3"});
+    REQUIRE(ids(list.findRange(CustomerField::CreditScore, 650.0, 700.0)) == std::vector<std::string>{"1", "2"});
+    REQUIRE(list.findRange(CustomerField::CreditScore, 900.0, 100.0).empty());
+
+    // ordered results come back in key order
+    std::vector<const Customer*> byScore = list.findRange(CustomerField::CreditScore, 0.0, 1000.0);
+    REQUIRE(byScore.size() == 3);
+    REQUIRE(byScore[0]->getCustomerID() == "2");
+    REQUIRE(byScore[2]->getCustomerID() == "3");
+}
+
+TEST_CASE("Indexes should follow deleteItem and makeEmpty") {
+    IndexedCustomerList<CustomerEqual<CustomerID>> list;
+    list.addIndex(CustomerField::Email, IndexKind::Hash);
+    list.addIndex(CustomerField::CreditScore, IndexKind::Ordered);
+    list.putItem(makeCustomer(1, "a@x.com", "60601", 700));
+    list.putItem(makeCustomer(2, "a@x.com", "60601", 700));
+
+    REQUIRE(list.deleteItem(makeCustomer(1, "", "", 0)));
+    REQUIRE_FALSE(list.deleteItem(makeCustomer(1, "", "", 0)));
+    REQUIRE(list.getLength() == 1);
+    REQUIRE(ids(list.findEqual(CustomerField::Email, "a@x.com")) == std::vector<std::string>{"2"});
+    REQUIRE(ids(list.findRange(CustomerField::CreditScore, 700.0, 700.0)) == std::vector<std::string>{"2"});
+
+    list.makeEmpty();
+    REQUIRE(list.getLength() == 0);
+    REQUIRE(list.findEqual(CustomerField::Email, "a@x.com").empty());
+    REQUIRE(list.findRange(CustomerField::CreditScore, 0.0, 1000.0).empty());
+}
+
+TEST_CASE("An index added later should cover the existing records") {
+    IndexedCustomerList<> list;
+    list.putItem(makeCustomer(1, "a@x.com", "60601", 700));
+    list.putItem(makeCustomer(2, "b@x.com", "97201", 650));
+
+    REQUIRE(ids(list.findEqual(CustomerField::Email, "b@x.com")) == std::vector<std::string>{"2"}); // scan
+    list.addIndex(CustomerField::Email, IndexKind::Ordered);
+    REQUIRE(list.hasIndex(CustomerField::Email, IndexKind::Ordered));
+    REQUIRE_FALSE(list.hasIndex(CustomerField::Email, IndexKind::Hash));
+    REQUIRE(ids(list.findEqual(CustomerField::Email, "b@x.com")) == std::vector<std::string>{"2"});
+    REQUIRE(ids(list.findRange(CustomerField::Email, "a", "az")) == std::vector<std::string>{"1"});
+}
+
+TEST_CASE("addIndex and findRange should reject unsupported fields") {
+    IndexedCustomerList<> list;
+    REQUIRE_THROWS_AS(list.addIndex(CustomerField::CreditScore, IndexKind::Hash), std::invalid_argument);
+    REQUIRE_THROWS_AS(list.addIndex(CustomerField::DateOfBirth, IndexKind::Ordered), std::invalid_argument);
+    REQUIRE_THROWS_AS(list.findRange(CustomerField::TotalSales, 0.0, 1.0), std::logic_error);
+    REQUIRE_THROWS_AS(list.findEqual(CustomerField::TotalSales, "1"), std::invalid_argument);
+}
+
+TEST_CASE("A copied list should index its own records") {
+    IndexedCustomerList<> original;
+    original.addIndex(CustomerField::Email, IndexKind::Hash);
+    original.putItem(makeCustomer(1, "a@x.com", "60601", 700));
+
+    IndexedCustomerList<> copy(original);
+    original.makeEmpty();
+    std::vector<const Customer*> found = copy.findEqual(CustomerField::Email, "a@x.com");
+    REQUIRE(found.size() == 1);
+    REQUIRE(found[0]->getCustomerID() == "1");
+
+    IndexedCustomerList<> moved(std::move(copy));
+    REQUIRE(moved.findEqual(CustomerField::Email, "a@x.com").size() == 1);
+}
+
+TEST_CASE("Indexed lookups should match a linear scan after random edits") {
+    IndexedCustomerList<CustomerEqual<CustomerID>> list;
+    list.addIndex(CustomerField::PostalCode, IndexKind::Hash);
+    list.addIndex(CustomerField::CreditScore, IndexKind::Ordered);
+    std::mt19937 rng(50);
+    for (int step = 0; step < 3000; ++step) {
+        int id = static_cast<int>(rng() % 500);
+        if (rng() % 3 == 0) list.deleteItem(makeCustomer(id, "", "", 0));
+        else list.putItem(makeCustomer(id, "e@x.com", std::to_string(60000 + rng() % 20), 300 + rng() % 551));
+    }
+
+    for (int zip = 60000; zip < 60020; ++zip) {
+        std::vector<const Customer*> scanned;
+        list.forEach([&](const Customer& c) { if (c.getPostalCode() == std::to_string(zip)) scanned.push_back(&c); });
+        REQUIRE(ids(list.findEqual(CustomerField::PostalCode, std::to_string(zip))) == ids(scanned));
+    }
+    std::vector<const Customer*> scanned;
+    list.forEach([&](const Customer& c) { if (c.getCreditScore() >= 500 && c.getCreditScore() <= 600) scanned.push_back(&c); });
+    REQUIRE(ids(list.findRange(CustomerField::CreditScore, 500.0, 600.0)) == ids(scanned));
+}
+
+TEST_CASE("A hash index on a shared value should survive deleting the record its key came from") {
+    IndexedCustomerList<CustomerEqual<CustomerID>> list;
+    list.addIndex(CustomerField::State, IndexKind::Hash);
+    for (int id = 0; id < 1000; ++id) {
+        Customer c = makeCustomer(id, "e@x.com", "60601", 700);
+        c.setState(id % 2 ? "OR" : "IL");
+        list.putItem(c);
+    }
+
+    // id 0 put first, so the "IL" key viewed its field
+    for (int id = 0; id < 1000; id += 4) REQUIRE(list.deleteItem(makeCustomer(id, "", "", 0)));
+    REQUIRE(list.findEqual(CustomerField::State, "IL").size() == 250);
+    REQUIRE(list.findEqual(CustomerField::State, "OR").size() == 500);
+    for (int id = 2; id < 1000; id += 4) REQUIRE(list.deleteItem(makeCustomer(id, "", "", 0)));
+    REQUIRE(list.findEqual(CustomerField::State, "IL").empty());
+    REQUIRE(list.getLength() == 500);
+}
+
+TEST_CASE("Ordered numeric indexes should reject NaN") {
+    Customer bad = makeCustomer(1, "a@x.com", "60601", 700);
+    bad.setTotalSales(std::nan(""));
+
+    IndexedCustomerList<> indexed;
+    indexed.addIndex(CustomerField::TotalSales, IndexKind::Ordered);
+    REQUIRE_THROWS_AS(indexed.putItem(bad), std::invalid_argument);
+    REQUIRE(indexed.getLength() == 0);
+
+    IndexedCustomerList<> plain;
+    plain.putItem(bad);
+    REQUIRE_THROWS_AS(plain.addIndex(CustomerField::TotalSales, IndexKind::Ordered), std::invalid_argument);
+    REQUIRE_FALSE(plain.hasIndex(CustomerField::TotalSales, IndexKind::Ordered));
+    plain.addIndex(CustomerField::CreditScore, IndexKind::Ordered); // NaN only matters in its own field
+    REQUIRE(plain.findRange(CustomerField::CreditScore, 700.0, 700.0).size() == 1);
+}
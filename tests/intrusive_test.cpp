@@ -0,0 +1,109 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../IntrusiveADTList.h"
+#include <set>
+
+// Tests for IntrusiveADTList
+
+struct ByValue {};
+struct ByParity {};
+
+struct Record : IntrusiveListHook<ByValue>, IntrusiveListHook<ByParity> {
+    int value = 0;
+    explicit Record(int v = 0) : value(v) {}
+    bool operator==(const Record& rhs) const { return value == rhs.value; }
+};
+
+TEST_CASE("New intrusive list should be empty") {
+    IntrusiveADTList<Record, ByValue> list;
+    REQUIRE(list.getLength() == 0);
+    REQUIRE_FALSE(list.isFull());
+    REQUIRE(list.begin() == list.end());
+}
+
+TEST_CASE("putItem should link the element itself, not a copy") {
+    Record records[3] = {Record(1), Record(2), Record(3)};
+    IntrusiveADTList<Record, ByValue> list;
+    for (Record& r : records) list.putItem(r);
+    REQUIRE(list.getLength() == 3);
+
+    Record* found = nullptr;
+    REQUIRE(list.getItem(Record(2), found));
+    REQUIRE(found == &records[1]);
+
+    found->value = 20;
+    std::set<int> seen;
+    for (IntrusiveADTList<Record, ByValue>::Iterator it = list.begin(); it != list.end(); ++it) {
+        seen.insert((*it).value);
+    }
+    REQUIRE(seen == std::set<int>{1, 20, 3});
+}
+
+TEST_CASE("deleteItem should unlink in O(1) and leave the element alive") {
+    Record a(1), b(2), c(3);
+    IntrusiveADTList<Record, ByValue> list;
+    list.putItem(a);
+    list.putItem(b);
+    list.putItem(c);
+
+    REQUIRE(list.deleteItem(b));
+    REQUIRE_FALSE(b.IntrusiveListHook<ByValue>::isLinked());
+    REQUIRE_FALSE(list.deleteItem(b));
+    REQUIRE(list.getLength() == 2);
+    Record* found = nullptr;
+    REQUIRE_FALSE(list.getItem(Record(2), found));
+    REQUIRE(b.value == 2);
+}
+
+TEST_CASE("An element can sit in two lists through different hooks") {
+    Record records[6];
+    IntrusiveADTList<Record, ByValue> all;
+    IntrusiveADTList<Record, ByParity> evens;
+    for (int i = 0; i < 6; ++i) {
+        records[i].value = i;
+        all.putItem(records[i]);
+        if (i % 2 == 0) evens.putItem(records[i]);
+    }
+    REQUIRE(all.getLength() == 6);
+    REQUIRE(evens.getLength() == 3);
+
+    REQUIRE(all.deleteItem(records[2]));
+    REQUIRE(records[2].IntrusiveListHook<ByParity>::isLinked());
+    REQUIRE(evens.getLength() == 3);
+}
+
+TEST_CASE("Linking an element twice through the same hook should throw") {
+    Record a(1);
+    IntrusiveADTList<Record, ByValue> list;
+    IntrusiveADTList<Record, ByValue> other;
+    list.putItem(a);
+    REQUIRE_THROWS_AS(other.putItem(a), std::logic_error);
+}
+
+TEST_CASE("makeEmpty and erase should unlink elements") {
+    Record records[4] = {Record(1), Record(2), Record(3), Record(4)};
+    IntrusiveADTList<Record, ByValue> list;
+    for (Record& r : records) list.putItem(r);
+
+    for (IntrusiveADTList<Record, ByValue>::Iterator it = list.begin(); it != list.end(); ) {
+        if ((*it).value % 2 == 0) it = list.erase(it);
+        else ++it;
+    }
+    REQUIRE(list.getLength() == 2);
+    REQUIRE_FALSE(records[1].IntrusiveListHook<ByValue>::isLinked());
+
+    list.makeEmpty();
+    REQUIRE(list.getLength() == 0);
+    for (Record& r : records) REQUIRE_FALSE(r.IntrusiveListHook<ByValue>::isLinked());
+    REQUIRE_THROWS_AS(*list.end(), std::out_of_range);
+}
+
+TEST_CASE("Copying an element should not copy its membership") {
+    Record a(1);
+    IntrusiveADTList<Record, ByValue> list;
+    list.putItem(a);
+    Record copy = a;
+    REQUIRE_FALSE(copy.IntrusiveListHook<ByValue>::isLinked());
+    list.putItem(copy);
+    REQUIRE(list.getLength() == 2);
+    list.makeEmpty();
+}
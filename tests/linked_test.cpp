@@ -2,6 +2,10 @@
 #include "../libs/catch_amalgamated.hpp"
 #include <string.h>
 #include "../LinkedADTList.h"
+#include "../Customer.h"
+#include "../CustomerComparators.h"
+#include <algorithm>
+#include <vector>
 
 // Tests for base methods of LinkedADTList
 
@@ -168,3 +172,304 @@ TEST_CASE("getItem should return false on an empty list") {
     int foundItem;
     REQUIRE_FALSE(list.getItem(10, foundItem)); // No items in the list
 }
+
+TEST_CASE("concat should append the other list and leave it empty") {
+    LinkedADTList<int> list;
+    list.putItem(2);
+    list.putItem(1);
+    LinkedADTList<int> other;
+    other.putItem(4);
+    other.putItem(3);
+    list.concat(std::move(other));
+    REQUIRE(list.getLength() == 4);
+    REQUIRE(other.getLength() == 0);
+
+    int expected = 1;
+    for (LinkedADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+        REQUIRE(*it == expected++);
+    }
+    // tail must still be correct after the concat
+    LinkedADTList<int> more;
+    more.putItem(5);
+    list.concat(std::move(more));
+    REQUIRE(list.getLength() == 5);
+    int item;
+    REQUIRE(list.getItem(5, item));
+}
+
+TEST_CASE("splice should prepend the other list and leave it empty") {
+    LinkedADTList<int> list;
+    list.putItem(3);
+    LinkedADTList<int> other;
+    other.putItem(2);
+    other.putItem(1);
+    list.splice(std::move(other));
+    REQUIRE(list.getLength() == 3);
+    REQUIRE(other.getLength() == 0);
+
+    int expected = 1;
+    for (LinkedADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+        REQUIRE(*it == expected++);
+    }
+}
+
+TEST_CASE("concat should merge many shards and keep the tail after deletes") {
+    LinkedADTList<int> merged;
+    for (int shard = 0; shard < 32; ++shard) {
+        LinkedADTList<int> part;
+        part.putItem(shard);
+        merged.concat(std::move(part));
+    }
+    REQUIRE(merged.getLength() == 32);
+
+    REQUIRE(merged.deleteItem(31)); // delete the tail node
+    LinkedADTList<int> last;
+    last.putItem(99);
+    merged.concat(std::move(last));
+    REQUIRE(merged.getLength() == 32);
+
+    int expected = 0;
+    for (LinkedADTList<int>::Iterator it = merged.begin(); it != merged.end(); ++it) {
+        REQUIRE(*it == (expected == 31 ? 99 : expected));
+        ++expected;
+    }
+}
+
+TEST_CASE("Move constructor should take over the nodes") {
+    LinkedADTList<int> list;
+    list.putItem(1);
+    list.putItem(2);
+    LinkedADTList<int> moved(std::move(list));
+    REQUIRE(moved.getLength() == 2);
+    REQUIRE(list.getLength() == 0);
+    list.putItem(3);
+    REQUIRE(list.getLength() == 1);
+}
+
+// Collect the items in iteration order so seek() can be checked against it
+static std::vector<int> itemsInOrder(LinkedADTList<int>& list) {
+    std::vector<int> items;
+    for (LinkedADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) {
+        items.push_back(*it);
+    }
+    return items;
+}
+
+TEST_CASE("seek should reach every position without a skip index") {
+    LinkedADTList<int> list;
+    for (int i = 0; i < 50; ++i) list.putItem(i);
+    std::vector<int> items = itemsInOrder(list);
+    for (int i = 0; i < 50; ++i) {
+        REQUIRE(*list.seek(i) == items[i]);
+    }
+    REQUIRE_FALSE(list.seek(50) != list.end());
+    REQUIRE_FALSE(list.seek(-1) != list.end());
+}
+
+TEST_CASE("Skip index should stay correct through putItem and deleteItem") {
+    LinkedADTList<int> list;
+    list.enableSkipIndex(4);
+    REQUIRE(list.hasSkipIndex());
+    for (int i = 0; i < 200; ++i) list.putItem(i);
+
+    // delete entry nodes, lead nodes, the head and the tail
+    for (int i = 0; i < 200; i += 3) REQUIRE(list.deleteItem(i));
+    REQUIRE(list.deleteItem(199));
+    REQUIRE(list.deleteItem(1));
+    for (int i = 200; i < 230; ++i) list.putItem(i);
+
+    std::vector<int> items = itemsInOrder(list);
+    REQUIRE(static_cast<int>(items.size()) == list.getLength());
+    for (int i = 0; i < list.getLength(); ++i) {
+        REQUIRE(*list.seek(i) == items[i]);
+    }
+}
+
+TEST_CASE("Automatic skip index should survive concat, copy and makeEmpty") {
+    LinkedADTList<int> list;
+    list.enableSkipIndex();
+    for (int i = 0; i < 1000; ++i) list.putItem(i);
+    LinkedADTList<int> more;
+    for (int i = 1000; i < 1100; ++i) more.putItem(i);
+    list.concat(std::move(more));
+
+    std::vector<int> items = itemsInOrder(list);
+    for (int i = 0; i < list.getLength(); i += 7) {
+        REQUIRE(*list.seek(i) == items[i]);
+    }
+
+    LinkedADTList<int> copy = list;
+    REQUIRE(copy.hasSkipIndex());
+    REQUIRE(*copy.seek(1099) == items[1099]);
+
+    list.makeEmpty();
+    REQUIRE_FALSE(list.seek(0) != list.end());
+    list.putItem(5);
+    REQUIRE(*list.seek(0) == 5);
+    list.disableSkipIndex();
+    REQUIRE_FALSE(list.hasSkipIndex());
+}
+
+TEST_CASE("find should return an iterator to the matching item or end()") {
+    LinkedADTList<int> list;
+    list.putItem(10);
+    list.putItem(20);
+    list.putItem(30);
+    LinkedADTList<int>::Iterator it = list.find(20);
+    REQUIRE(it != list.end());
+    REQUIRE(*it == 20);
+    REQUIRE(list.find(40) == list.end());
+}
+
+TEST_CASE("A missed find should throw on dereference and stay at the end") {
+    LinkedADTList<int> list;
+    list.putItem(10);
+    LinkedADTList<int>::Iterator miss = list.find(40);
+    REQUIRE_THROWS_AS(*miss, std::out_of_range);
+    ++miss;
+    REQUIRE(miss == list.end());
+    REQUIRE_THROWS_AS(*list.end(), std::out_of_range);
+}
+
+TEST_CASE("erase should unlink head, middle and tail items") {
+    LinkedADTList<int> list;
+    for (int i = 4; i >= 1; --i) list.putItem(i); // 1 2 3 4
+
+    LinkedADTList<int>::Iterator next = list.erase(list.find(2)); // middle
+    REQUIRE(*next == 3);
+    next = list.erase(list.find(1)); // head
+    REQUIRE(*next == 3);
+    next = list.erase(list.find(4)); // tail
+    REQUIRE(next == list.end());
+    REQUIRE(list.getLength() == 1);
+
+    // the tail pointer must have moved back to 3
+    LinkedADTList<int> more;
+    more.putItem(5);
+    list.concat(std::move(more));
+    std::vector<int> items = itemsInOrder(list);
+    REQUIRE(items == std::vector<int>{3, 5});
+}
+
+TEST_CASE("erase should work while iterating and on seek() positions") {
+    LinkedADTList<int> list;
+    list.enableSkipIndex(2);
+    for (int i = 0; i < 10; ++i) list.putItem(i);
+
+    // remove the even values in one pass
+    for (LinkedADTList<int>::Iterator it = list.begin(); it != list.end(); ) {
+        if (*it % 2 == 0) it = list.erase(it);
+        else ++it;
+    }
+    REQUIRE(list.getLength() == 5);
+
+    list.erase(list.seek(2)); // iterator without a remembered predecessor
+    std::vector<int> items = itemsInOrder(list);
+    REQUIRE(items == std::vector<int>{9, 7, 3, 1});
+    for (int i = 0; i < list.getLength(); ++i) {
+        REQUIRE(*list.seek(i) == items[i]);
+    }
+}
+
+TEST_CASE("erase should not read a predecessor deleted after find") {
+    LinkedADTList<int> list;
+    for (int i = 3; i >= 1; --i) list.putItem(i); // 1 2 3
+
+    LinkedADTList<int>::Iterator it = list.find(3); // remembers node 2
+    REQUIRE(list.deleteItem(2));
+    REQUIRE(list.erase(it) == list.end());
+    REQUIRE(itemsInOrder(list) == std::vector<int>{1});
+
+    // two find() results, erased in order: the second's predecessor is the first
+    for (int i = 6; i >= 2; --i) list.putItem(i); // 2 3 4 5 6 1
+    LinkedADTList<int>::Iterator four = list.find(4);
+    LinkedADTList<int>::Iterator five = list.find(5);
+    list.erase(four);
+    list.erase(five);
+    REQUIRE(itemsInOrder(list) == std::vector<int>{2, 3, 6, 1});
+}
+
+TEST_CASE("sort should order the nodes and keep the tail correct") {
+    LinkedADTList<int> list;
+    int values[] = {5, 3, 9, 1, 7, 3, 8, 2, 6, 4, 0};
+    for (int v : values) list.putItem(v);
+    list.sort();
+    REQUIRE(itemsInOrder(list) == std::vector<int>{0, 1, 2, 3, 3, 4, 5, 6, 7, 8, 9});
+
+    LinkedADTList<int> more;
+    more.putItem(10);
+    list.concat(std::move(more));
+    REQUIRE(itemsInOrder(list).back() == 10);
+
+    list.sort(std::greater<int>());
+    REQUIRE(*list.begin() == 10);
+    REQUIRE(*list.seek(list.getLength() - 1) == 0);
+}
+
+TEST_CASE("sort should handle empty, single and large lists") {
+    LinkedADTList<int> list;
+    list.sort();
+    REQUIRE(list.getLength() == 0);
+    list.putItem(1);
+    list.sort();
+    REQUIRE(*list.begin() == 1);
+
+    LinkedADTList<int> big;
+    big.enableSkipIndex();
+    for (int i = 0; i < 10000; ++i) big.putItem((i * 7919) % 10007);
+    big.sort();
+    std::vector<int> items = itemsInOrder(big);
+    REQUIRE(static_cast<int>(items.size()) == 10000);
+    REQUIRE(std::is_sorted(items.begin(), items.end()));
+    REQUIRE(*big.seek(5000) == items[5000]);
+}
+
+TEST_CASE("sort should order customers by the active compare mode") {
+    LinkedADTList<Customer> list;
+    int scores[] = {720, 580, 810, 655};
+    for (int i = 0; i < 4; ++i) {
+        list.putItem(Customer("C" + std::to_string(i), "user", "First", "Last", "1 Main St",
+                              "City", "ST", "00000", "a@b.c", "F", "Co", "Job",
+                              Date(2020, 1, 1), "000-00-0000", Date(1990, 1, 1),
+                              50000, scores[i], 0.0));
+    }
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    Customer::setCompareWith(CreditScore);
+    list.sort();
+    Customer::setCompareWith(saved);
+
+    std::vector<int> sorted;
+    for (LinkedADTList<Customer>::Iterator it = list.begin(); it != list.end(); ++it) {
+        sorted.push_back((*it).getCreditScore());
+    }
+    REQUIRE(sorted == std::vector<int>{580, 655, 720, 810});
+}
+
+TEST_CASE("A KeyEqual parameter should fix the lookup key independently of the compare mode") {
+    auto make = [](const std::string& id, int score) {
+        return Customer(id, "user" + id, "First", "Last", "1 Main St", "City", "ST", "00000",
+                        "a@b.c", "F", "Co", "Job", Date(2020, 1, 1), "000-00-0000",
+                        Date(1990, 1, 1), 50000, score, 0.0);
+    };
+    LinkedADTList<Customer, CustomerEqual<CustomerID>> byId;
+    byId.putItem(make("C1", 700));
+    byId.putItem(make("C2", 600));
+    byId.putItem(make("C3", 800));
+
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    Customer::setCompareWith(CreditScore); // must not affect byId
+
+    Customer probe = make("C2", 0), found;
+    REQUIRE(byId.getItem(probe, found));
+    REQUIRE(found.getCreditScore() == 600);
+
+    byId.sort(CustomerLess<CreditScore>());
+    std::vector<std::string> ids;
+    for (auto it = byId.begin(); it != byId.end(); ++it) ids.push_back((*it).getCustomerID());
+    REQUIRE(ids == std::vector<std::string>{"C2", "C1", "C3"});
+
+    REQUIRE(byId.deleteItem(probe));
+    REQUIRE_FALSE(byId.getItem(probe, found));
+    REQUIRE(byId.getLength() == 2);
+    Customer::setCompareWith(saved);
+}
@@ -0,0 +1,74 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../ParallelSort.h"
+#include "../Customer.h"
+#include "../CustomerComparators.h"
+#include <algorithm>
+#include <random>
+#include <string>
+#include <vector>
+
+// Tests for parallelSort
+
+template <typename T, typename KeyEqual>
+static std::vector<T> contents(ArrayADTList<T, KeyEqual>& list) {
+    return std::vector<T>(list.begin(), list.end());
+}
+
+TEST_CASE("parallelSort should match std::sort for any thread count") {
+    std::mt19937 rng(21);
+    const int n = 300000;
+    ArrayADTList<int> list(n);
+    for (int i = 0; i < n; ++i) list.putItem(static_cast<int>(rng() % 1000) - 500); // many duplicates
+    std::vector<int> expected = contents(list);
+    std::sort(expected.begin(), expected.end());
+
+    for (unsigned threads : {1u, 2u, 3u, 8u, 64u}) {
+        ArrayADTList<int> copy = list;
+        parallelSort(copy, std::less<int>(), threads);
+        INFO("threads: " << threads);
+        REQUIRE(contents(copy) == expected);
+    }
+}
+
+TEST_CASE("parallelSort should take a custom comparator and handle tiny lists") {
+    ArrayADTList<double> empty;
+    parallelSort(empty);
+    REQUIRE(empty.getLength() == 0);
+
+    ArrayADTList<double> small;
+    small.putItem(2.5);
+    small.putItem(-1.0);
+    small.putItem(9.0);
+    parallelSort(small, std::greater<double>(), 4);
+    REQUIRE(contents(small) == std::vector<double>{9.0, 2.5, -1.0});
+}
+
+TEST_CASE("parallelSort should order customers by a fixed key or the compare mode") {
+    std::mt19937 rng(8);
+    const int n = 70000;
+    ArrayADTList<Customer> list(n);
+    for (int i = 0; i < n; ++i) {
+        Customer c;
+        c.setCustomerID("C" + std::to_string(i));
+        c.setCreditScore(300 + static_cast<int>(rng() % 551));
+        c.setLastName("Name" + std::to_string(rng() % 5000));
+        list.putItem(c);
+    }
+
+    ArrayADTList<Customer> byScore = list;
+    parallelSort(byScore, CustomerLess<CreditScore>(), 4);
+    REQUIRE(std::is_sorted(byScore.begin(), byScore.end(), CustomerLess<CreditScore>()));
+    REQUIRE(byScore.getLength() == n);
+
+    CustomerCompareOptions saved = Customer::getCompareWith();
+    Customer::setCompareWith(FullName);
+    ArrayADTList<Customer> byName = list;
+    parallelSort(byName, std::less<Customer>(), 4);
+    Customer::setCompareWith(saved);
+    REQUIRE(std::is_sorted(byName.begin(), byName.end(), CustomerLess<FullName>()));
+
+    std::vector<std::string> ids;
+    for (const Customer& c : contents(byName)) ids.push_back(c.getCustomerID());
+    std::sort(ids.begin(), ids.end());
+    REQUIRE(std::adjacent_find(ids.begin(), ids.end()) == ids.end()); // nothing lost or duplicated
+}
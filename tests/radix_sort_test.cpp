@@ -0,0 +1,82 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../RadixSort.h"
+#include "../CustomerComparators.h"
+#include <algorithm>
+#include <climits>
+#include <random>
+#include <vector>
+
+// Tests for RadixSort
+
+static Customer makeCustomer(const std::string& id, int score, int income, Date since, Date dob) {
+    return Customer(id, "user", "First", "Last", "1 Main St", "City", "ST", "62704",
+                    "a@b.com", "F", "Co", "Job", since, "123-45-6789", dob, income, score, 0.0);
+}
+
+static std::vector<std::string> ids(ArrayADTList<Customer>& list) {
+    std::vector<std::string> out;
+    for (ArrayADTList<Customer>::Iterator it = list.begin(); it != list.end(); ++it) out.push_back((*it).getCustomerID());
+    return out;
+}
+
+TEST_CASE("radixSortOrder should be a stable sort of the keys") {
+    std::vector<std::uint32_t> keys = {5, 0xFFFFFFFFu, 5, 0, 70000, 5, 0x01000000u};
+    std::vector<std::uint32_t> order = radixSortOrder(keys);
+    REQUIRE(order == std::vector<std::uint32_t>{3, 0, 2, 5, 4, 6, 1});
+    REQUIRE(radixSortOrder(std::vector<std::uint32_t>{}).empty());
+}
+
+TEST_CASE("radixSort should sort an int list, negatives included") {
+    std::mt19937 rng(5);
+    ArrayADTList<int> list(2000);
+    std::vector<int> expected;
+    for (int i = 0; i < 2000; ++i) {
+        int v = static_cast<int>(rng());
+        if (i == 7) v = INT_MIN;
+        if (i == 8) v = INT_MAX;
+        list.putItem(v);
+        expected.push_back(v);
+    }
+    std::sort(expected.begin(), expected.end());
+    radixSort(list);
+
+    std::vector<int> sorted;
+    for (ArrayADTList<int>::Iterator it = list.begin(); it != list.end(); ++it) sorted.push_back(*it);
+    REQUIRE(sorted == expected);
+}
+
+TEST_CASE("radixSort should order customers like CustomerLess, ties by customer_id") {
+    std::mt19937 rng(11);
+    ArrayADTList<Customer> list(500);
+    std::vector<Customer> expected;
+    for (int i = 0; i < 500; ++i) {
+        Customer c = makeCustomer("C" + std::to_string(rng() % 100000), 300 + static_cast<int>(rng() % 20),
+                                  static_cast<int>(rng() % 50) - 25,
+                                  Date(2000 + rng() % 3, 1 + rng() % 12, 1 + rng() % 28),
+                                  Date(1960 + rng() % 3, 1 + rng() % 2, 1));
+        list.putItem(c);
+        expected.push_back(c);
+    }
+
+    auto check = [&](CustomerCompareOptions key, auto less) {
+        std::vector<Customer> want = expected;
+        std::stable_sort(want.begin(), want.end(), less);
+        ArrayADTList<Customer> copy = list;
+        radixSort(copy, key);
+        std::vector<std::string> wantIds;
+        for (const Customer& c : want) wantIds.push_back(c.getCustomerID());
+        REQUIRE(ids(copy) == wantIds);
+    };
+    check(CreditScore, CustomerLess<CreditScore>());
+    check(HouseholdIncome, CustomerLess<HouseholdIncome>());
+    check(CustomerSince, CustomerLess<CustomerSince>());
+    check(DateOfBirth, CustomerLess<DateOfBirth>());
+}
+
+TEST_CASE("radixSort should reject string keys and leave the list alone") {
+    ArrayADTList<Customer> list(2);
+    list.putItem(makeCustomer("2", 700, 0, Date(), Date()));
+    list.putItem(makeCustomer("1", 600, 0, Date(), Date()));
+    REQUIRE_THROWS_AS(radixSort(list, FullName), std::invalid_argument);
+    REQUIRE(ids(list) == std::vector<std::string>{"2", "1"});
+}
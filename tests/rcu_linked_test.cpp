@@ -0,0 +1,111 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../RcuLinkedADTList.h"
+#include <atomic>
+#include <mutex>
+#include <thread>
+#include <vector>
+
+// Tests for RcuLinkedADTList
+
+TEST_CASE("Writer-side operations should behave like an unordered list") {
+    RcuLinkedADTList<int> list;
+    REQUIRE(list.getLength() == 0);
+    REQUIRE_FALSE(list.isFull());
+    list.putItem(1);
+    list.putItem(2);
+    list.putItem(3);
+    REQUIRE(list.getLength() == 3);
+
+    int found;
+    REQUIRE(list.getItem(2, found));
+    REQUIRE(list.deleteItem(2));
+    REQUIRE_FALSE(list.getItem(2, found));
+    REQUIRE_FALSE(list.deleteItem(2));
+    REQUIRE(list.getLength() == 2);
+
+    list.makeEmpty();
+    REQUIRE(list.getLength() == 0);
+    list.synchronize();
+    REQUIRE(list.pendingReclaims() == 0);
+}
+
+TEST_CASE("A reader should see a consistent list") {
+    RcuLinkedADTList<int> list;
+    for (int i = 0; i < 10; ++i) list.putItem(i);
+
+    RcuLinkedADTList<int>::Reader reader = list.registerReader();
+    int found;
+    REQUIRE(reader.getItem(7, found));
+    REQUIRE(found == 7);
+    REQUIRE_FALSE(reader.getItem(70, found));
+
+    int sum = 0;
+    reader.forEach([&](const int& v) { sum += v; });
+    REQUIRE(sum == 45);
+}
+
+TEST_CASE("Unlinked nodes should wait for readers inside a read-side section") {
+    RcuLinkedADTList<int> list;
+    list.putItem(1);
+    list.putItem(2);
+    RcuLinkedADTList<int>::Reader reader = list.registerReader();
+
+    reader.lock();
+    RcuLinkedADTList<int>::Iterator it = list.begin(); // standing on 2
+    REQUIRE(list.deleteItem(2));
+    list.reclaim();
+    REQUIRE(list.pendingReclaims() == 1);
+    REQUIRE(*it == 2);     // still safe to read
+    ++it;
+    REQUIRE(*it == 1);     // and the rest of the chain is intact
+    reader.unlock();
+
+    list.reclaim();
+    REQUIRE(list.pendingReclaims() == 0);
+}
+
+TEST_CASE("Registering more than MAX_READERS readers should throw") {
+    RcuLinkedADTList<int> list;
+    std::vector<RcuLinkedADTList<int>::Reader> readers;
+    for (int i = 0; i < RcuLinkedADTList<int>::MAX_READERS; ++i) {
+        readers.push_back(list.registerReader());
+    }
+    REQUIRE_THROWS_AS(list.registerReader(), std::overflow_error);
+    readers.pop_back();
+    REQUIRE_NOTHROW(list.registerReader());
+}
+
+TEST_CASE("Readers should run concurrently with a writer") {
+    RcuLinkedADTList<int> list;
+    const int KEEP = 100; // values 0..99 are never deleted
+    for (int i = 0; i < KEEP; ++i) list.putItem(i);
+
+    std::atomic<bool> done(false);
+    std::atomic<int> badReads(0);
+    std::vector<std::thread> readers;
+    for (int r = 0; r < 3; ++r) {
+        readers.emplace_back([&] {
+            RcuLinkedADTList<int>::Reader reader = list.registerReader();
+            while (!done.load()) {
+                int kept = 0;
+                reader.forEach([&](const int& v) { if (v < KEEP) ++kept; });
+                if (kept != KEEP) badReads.fetch_add(1);
+            }
+        });
+    }
+
+    for (int round = 0; round < 2000; ++round) {
+        list.putItem(KEEP + round);
+        if (round % 2 == 1) {
+            list.deleteItem(KEEP + round);
+            list.deleteItem(KEEP + round - 1);
+        }
+    }
+    done.store(true);
+    for (std::thread& t : readers) t.join();
+
+    list.synchronize();
+    REQUIRE(badReads.load() == 0);
+    REQUIRE(list.getLength() == KEEP);
+    REQUIRE(list.pendingReclaims() == 0);
+}
@@ -0,0 +1,101 @@
+#include "../libs/catch_amalgamated.hpp"
+#include "../TopK.h"
+#include "../LinkedADTList.h"
+#include <algorithm>
+#include <limits>
+#include <random>
+#include <sstream>
+#include <string>
+#include <vector>
+
+// Tests for TopKAccumulator and topK
+
+static Customer makeCustomer(int id, int score, double sales) {
+    return Customer(std::to_string(id), "user", "First", "Last", "1 Main St", "City", "ST", "62704",
+                    "a@b.com", "F", "Co", "Job", Date(2012, 3, 15), "123-45-6789", Date(1985, 7, 4),
+                    85000, score, sales);
+}
+
+static std::vector<std::string> ids(const std::vector<Customer>& customers) {
+    std::vector<std::string> out;
+    for (const Customer& c : customers) out.push_back(c.getCustomerID());
+    return out;
+}
+
+TEST_CASE("TopKAccumulator should keep the k greatest items, best first") {
+    TopKAccumulator<int> acc(3);
+    for (int v : {5, 1, 9, 7, 3, 9, 2}) acc.push(v);
+    REQUIRE(acc.size() == 3);
+    REQUIRE(acc.result() == std::vector<int>{9, 9, 7});
+
+    TopKAccumulator<int> fewer(10);
+    fewer.push(4);
+    fewer.push(8);
+    REQUIRE(fewer.result() == std::vector<int>{8, 4});
+
+    TopKAccumulator<int> none(0);
+    none.push(1);
+    REQUIRE(none.result().empty());
+
+    TopKAccumulator<int, std::greater<int>> smallest(2, std::greater<int>());
+    for (int v : {5, 1, 9, 0}) smallest.push(v);
+    REQUIRE(smallest.result() == std::vector<int>{0, 1});
+}
+
+TEST_CASE("topK should match a full sort on both list types") {
+    std::mt19937 rng(4);
+    ArrayADTList<Customer> array(2000);
+    LinkedADTList<Customer> linked;
+    std::vector<Customer> all;
+    for (int i = 0; i < 2000; ++i) {
+        Customer c = makeCustomer(i, 300 + static_cast<int>(rng() % 551), (rng() % 100000) / 100.0);
+        array.putItem(c);
+        linked.putItem(c);
+        all.push_back(c);
+    }
+    std::sort(all.begin(), all.end(), [](const Customer& a, const Customer& b) {
+        return CustomerLess<TotalSales>()(b, a);
+    });
+    std::vector<Customer> expected(all.begin(), all.begin() + 100);
+
+    REQUIRE(ids(topK(array, 100, TotalSales)) == ids(expected));
+    REQUIRE(ids(topK(linked, 100, TotalSales)) == ids(expected));
+    REQUIRE(ids(topK(array, 100, CustomerLess<TotalSales>())) == ids(expected));
+    for (unsigned threads : {1u, 3u, 8u}) {
+        REQUIRE(ids(parallelTopK(array, 100, TotalSales, threads)) == ids(expected));
+    }
+
+    std::vector<Customer> byScore = topK(linked, 5, CreditScore);
+    REQUIRE(byScore.size() == 5);
+    REQUIRE(std::is_sorted(byScore.rbegin(), byScore.rend(), CustomerLess<CreditScore>()));
+}
+
+TEST_CASE("topK should accept a k far larger than the input") {
+    ArrayADTList<int> list(16);
+    for (int v : {4, 8, 1}) list.putItem(v);
+    const std::size_t all = std::numeric_limits<std::size_t>::max();
+
+    TopKAccumulator<int> acc(all);
+    acc.reserve(3);
+    acc.push(2);
+    REQUIRE(acc.result() == std::vector<int>{2});
+
+    REQUIRE(topK(list, all, std::less<int>()) == std::vector<int>{8, 4, 1});
+    REQUIRE(parallelTopK(list, all, std::less<int>(), 4) == std::vector<int>{8, 4, 1});
+}
+
+TEST_CASE("topK should stream customers out of a reader") {
+    std::ostringstream file;
+    int scores[] = {610, 790, 705, 820, 555};
+    for (int i = 0; i < 5; ++i) {
+        file << i << "\tu\tF\tL\ts\tc\tST\t1\te\tM\tco\tj\t1/2/2000\tssn\t12/31/1999\t10\t"
+             << scores[i] << "\t2.5\n";
+    }
+    file << "not a record\n";
+    std::istringstream in(file.str());
+    CustomerReader reader(in);
+
+    std::vector<Customer> top = topK(reader, 2, CreditScore);
+    REQUIRE(ids(top) == std::vector<std::string>{"3", "1"});
+    REQUIRE(reader.recordsRead() == 5);
+}